@@ -13,6 +13,7 @@
 #define ISO8601_UTC_INDICATOR 'Z'
 #define PREFIX_LENGTH 3
 #define ZONE_NAME_MAX_LENGTH 32
+#define ZONE_LONG_NAME_MAX_LENGTH 64
 #define ZONE_DOUBLE_DIGIT_COUNT 2
 #define ZONE_SINGLE_DIGIT_COUNT 1
 #define ZONE_DIGIT_COUNT_WITH_SECONDS_SEPARATOR 7
@@ -26,7 +27,7 @@
 #define UNINITIALIZED_DATE (Date){0}
 #define UNINITIALIZED_TIME (Time){.hours = -1, .minutes = -1, .seconds = 0, .millis = 0}
 #define UNINITIALIZED_DATE_TIME (DateTime){.date = {0}, .time = {.hours = -1, .minutes = -1, .seconds = -1, .millis = -1}}
-#define UNINITIALIZED_ZONED_DATE_TIME (ZonedDateTime){ .dateTime.date = {0}, .dateTime.time = {.hours = -1, .minutes = -1, .seconds = -1, .millis = -1}, .zone = {.id = NULL}}
+#define UNINITIALIZED_ZONED_DATE_TIME (ZonedDateTime){ .dateTime.date = {0}, .dateTime.time = {.hours = -1, .minutes = -1, .seconds = -1, .millis = -1}, .zone = ZONE_HANDLE_NONE}
 
 
 typedef struct {
@@ -42,7 +43,7 @@ typedef enum AmPmOfTime {
 static void initDateTimeFormatter(DateTimeFormatter *formatter);
 static void setFormatterError(DateTimeFormatter *formatter, const char *errorMessage, uint32_t errorIndex);
 
-static bool dateTimeParse(const char *text, TemporalField *formatEntities, Date *date, Time *time, TimeZone *zone);
+static bool dateTimeParse(const char *text, TemporalField *formatEntities, Date *date, Time *time, TimeZone *zone, const ZoneNameCandidate **zoneName);
 
 static bool haveDateTimeConflicts(TemporalField *formatEntities);
 static bool containsField(TemporalField *formatEntities, ChronoField field);
@@ -58,10 +59,15 @@ static uint8_t parseHourOfAmPm(TemporalField *temporal, Time *time, const char *
 static uint8_t parseMinutesOfHour(TemporalField *temporal, Time *time, const char *text);
 static uint8_t parseSecondsOfMinute(TemporalField *temporal, Time *time, const char *text);
 static uint8_t parseMilliseconds(TemporalField *temporal, Time *time, const char *text);
-static uint8_t parseTimeZone(TimeZone *zone, const char *text);
+static uint8_t parseTimeZone(TimeZone *zone, const ZoneNameCandidate **zoneName, const char *text);
+static uint8_t parseTextTimeZone(TemporalField *temporal, TimeZone *zone, const ZoneNameCandidate **zoneName, const char *text);
 
 static uint32_t parseZoneDigits(const char *text, uint32_t textLength, TimeZone *zone, int8_t sign);
-static uint32_t parseZoneByName(const char *text, uint32_t textLength, TimeZone *zone);
+static uint32_t parseZoneByName(const char *text, uint32_t textLength, TimeZone *zone, const ZoneNameCandidate **zoneName);
+static uint32_t parseZoneByLongName(const char *text, TimeZone *zone, const ZoneNameCandidate **zoneName);
+static bool isZoneLongNameChar(char nameChar);
+static bool setZoneOfNameCandidates(const char *name, uint32_t length, TimeZone *zone, const ZoneNameCandidate **zoneName);
+static ZonedDateTime zonedDateTimeOfZoneName(DateTime *dateTime, const ZoneNameCandidate *zoneName);
 static int64_t extractTemporalNumber(TemporalField *temporal, const char *text, uint8_t *parsedLength);
 static void resolveAmPmIfPresent(Time *time, AmPmOfTime amPm);
 static bool checkThatDateValid(Date *date, TemporalField *formatEntities);
@@ -101,7 +107,7 @@ static inline int8_t charToOffsetSign(char signChar) {
 TimeZone timeZoneOf(const char *zoneId) {
     TimeZone zone = UNINITIALIZED_ZONE;
     static TemporalField timeZoneFormat[] = {{.field = CHRONO_FIELD_DIGIT_TIME_ZONE}, {.field = CHRONO_END_OF_PATTERN}};
-    return dateTimeParse(zoneId, timeZoneFormat, NULL, NULL, &zone) ? zone : UNINITIALIZED_ZONE;
+    return dateTimeParse(zoneId, timeZoneFormat, NULL, NULL, &zone, NULL) ? zone : UNINITIALIZED_ZONE;
 }
 
 void parseDateTimePattern(DateTimeFormatter *formatter, const char *pattern) {
@@ -183,7 +189,7 @@ void parseDateTimePattern(DateTimeFormatter *formatter, const char *pattern) {
 Time parseToTime(const char *text, DateTimeFormatter *formatter) {
     if (formatter != NULL && formatter->isFormatValid) {
         Time time = {0};
-        if (dateTimeParse(text, formatter->formatEntities, NULL, &time, NULL)) {
+        if (dateTimeParse(text, formatter->formatEntities, NULL, &time, NULL, NULL)) {
             return time;
         }
     }
@@ -193,7 +199,7 @@ Time parseToTime(const char *text, DateTimeFormatter *formatter) {
 Date parseToDate(const char *text, DateTimeFormatter *formatter) {
     if (formatter != NULL && formatter->isFormatValid) {
         Date date = {0};
-        if (dateTimeParse(text, formatter->formatEntities, &date, NULL, NULL)) {
+        if (dateTimeParse(text, formatter->formatEntities, &date, NULL, NULL, NULL)) {
             return date;
         }
     }
@@ -203,7 +209,7 @@ Date parseToDate(const char *text, DateTimeFormatter *formatter) {
 DateTime parseToDateTime(const char *text, DateTimeFormatter *formatter) {
     if (formatter != NULL && formatter->isFormatValid) {
         DateTime dateTime = {0};
-        if (dateTimeParse(text, formatter->formatEntities, &dateTime.date, &dateTime.time, NULL)) {
+        if (dateTimeParse(text, formatter->formatEntities, &dateTime.date, &dateTime.time, NULL, NULL)) {
             return dateTime;
         }
     }
@@ -214,8 +220,15 @@ ZonedDateTime parseToZonedDateTime(const char *text, DateTimeFormatter *formatte
     if (formatter != NULL && formatter->isFormatValid) {
         DateTime dateTime = {0};
         TimeZone zone = {0};
-        if (dateTimeParse(text, formatter->formatEntities, &dateTime.date, &dateTime.time, &zone)) {
-            return zonedDateTimeOfDateTime(&dateTime, &zone);
+        const ZoneNameCandidate *zoneName = NULL;
+        if (dateTimeParse(text, formatter->formatEntities, &dateTime.date, &dateTime.time, &zone, &zoneName)) {
+            if (zoneName != NULL) {     // abbreviation or long name gives offset, not only zone
+                return zonedDateTimeOfZoneName(&dateTime, zoneName);
+            }
+            // parsed zone is ZONE_LIST zone or fixed offset, pointer to local zone can't be kept as external zone
+            if (zoneHandleOf(&zone) != ZONE_HANDLE_EXTERNAL) {
+                return zonedDateTimeOfDateTime(&dateTime, &zone);
+            }
         }
     }
     return UNINITIALIZED_ZONED_DATE_TIME;
@@ -234,10 +247,12 @@ void formatDateTime(DateTime *dateTime, char *resultBuffer, uint32_t length, Dat
 }
 
 void formatZonedDateTime(ZonedDateTime *zonedDateTime, char *resultBuffer, uint32_t length, DateTimeFormatter *formatter) {
-    dateTimeFormat(&zonedDateTime->dateTime.date, &zonedDateTime->dateTime.time, &zonedDateTime->zone, resultBuffer, length, formatter);
+    TimeZone fixedZone;
+    const TimeZone *zone = resolveZoneHandle(zonedDateTime->zone, zonedDateTime->externalZone, zonedDateTime->offset, &fixedZone);
+    dateTimeFormat(&zonedDateTime->dateTime.date, &zonedDateTime->dateTime.time, zone, resultBuffer, length, formatter);
 }
 
-static bool dateTimeParse(const char *text, TemporalField *formatEntities, Date *date, Time *time, TimeZone *zone) {
+static bool dateTimeParse(const char *text, TemporalField *formatEntities, Date *date, Time *time, TimeZone *zone, const ZoneNameCandidate **zoneName) {
     if (text == NULL || formatEntities == NULL || haveDateTimeConflicts(formatEntities)) return false;
 
     uint32_t i = 0;
@@ -278,8 +293,11 @@ static bool dateTimeParse(const char *text, TemporalField *formatEntities, Date
             case CHRONO_FIELD_MILLISECOND:
                 parsedLength = parseMilliseconds(temporal, time, text);
                 break;
+            case CHRONO_FIELD_TEXT_TIME_ZONE:
+                parsedLength = parseTextTimeZone(temporal, zone, zoneName, text);
+                break;
             case CHRONO_FIELD_DIGIT_TIME_ZONE:
-                parsedLength = parseTimeZone(zone, text);
+                parsedLength = parseTimeZone(zone, zoneName, text);
                 break;
             case CHRONO_FIELD_LITERAL:
                 parsedLength = temporal->length;      // skip literal pattern
@@ -636,7 +654,7 @@ static uint8_t parseMilliseconds(TemporalField *temporal, Time *time, const char
     return TEXT_NOT_PARSED;
 }
 
-static uint8_t parseTimeZone(TimeZone *zone, const char *text) {
+static uint8_t parseTimeZone(TimeZone *zone, const ZoneNameCandidate **zoneName, const char *text) {
     if (zone == NULL) return TEXT_NOT_PARSED;
 
     if (*text == ISO8601_UTC_INDICATOR) {
@@ -644,6 +662,8 @@ static uint8_t parseTimeZone(TimeZone *zone, const char *text) {
         zone->utcOffset = UTC.utcOffset;
         zone->names = UTC.names;
         zone->rules = UTC.rules;
+        zone->ruleCount = UTC.ruleCount;
+        zone->recurringRule = UTC.recurringRule;
         return 1;
     }
 
@@ -679,13 +699,24 @@ static uint8_t parseTimeZone(TimeZone *zone, const char *text) {
             return parsedLength;
 
         } else {    // Try parsing the text as a time zone name or abbreviation.
-            return parseZoneByName(text, textLength, zone);
+            return parseZoneByName(text, textLength, zone, zoneName);
         }
     }
     // Parse the rest as "hh:mm" or "hhmm" (RFC 822), also check optional seconds
     return parseZoneDigits(text, textLength, zone, sign);
 }
 
+static uint8_t parseTextTimeZone(TemporalField *temporal, TimeZone *zone, const ZoneNameCandidate **zoneName, const char *text) {
+    if (zone == NULL) return TEXT_NOT_PARSED;
+    if (temporal->length == PATTERN_LENGTH_FOUR) {  // parse long zone name like: "Pacific Daylight Time"
+        uint32_t parsedLength = parseZoneByLongName(text, zone, zoneName);
+        if (parsedLength != TEXT_NOT_PARSED) {
+            return parsedLength;
+        }
+    }
+    return parseTimeZone(zone, zoneName, text);   // zone id, abbreviation like "PST" or offset
+}
+
 static uint32_t parseZoneDigits(const char *text, uint32_t textLength, TimeZone *zone, int8_t sign) {
     const char *textStart = text;
     char timeBuffer[ZONE_DOUBLE_DIGIT_COUNT + 1] = {0};
@@ -707,6 +738,8 @@ static uint32_t parseZoneDigits(const char *text, uint32_t textLength, TimeZone
         zone->utcOffset = offset * sign;
         zone->names = UTC.names;
         zone->rules = UTC.rules;
+        zone->ruleCount = UTC.ruleCount;
+        zone->recurringRule = UTC.recurringRule;
         return (text - textStart);
     }
 
@@ -741,34 +774,88 @@ static uint32_t parseZoneDigits(const char *text, uint32_t textLength, TimeZone
     zone->utcOffset = offset * sign;
     zone->names = UTC.names;
     zone->rules = UTC.rules;
+    zone->ruleCount = UTC.ruleCount;
+    zone->recurringRule = UTC.recurringRule;
     return (text - textStart);
 }
 
-static uint32_t parseZoneByName(const char *text, uint32_t textLength, TimeZone *zone) {
+static uint32_t parseZoneByName(const char *text, uint32_t textLength, TimeZone *zone, const ZoneNameCandidate **zoneName) {
     const char *textStart = text;
-    static char zoneNameBuffer[ZONE_NAME_MAX_LENGTH + 2];
-    memset(zoneNameBuffer, 0, ZONE_NAME_MAX_LENGTH + 2);
     for (uint8_t i = 0; i < ZONE_NAME_MAX_LENGTH && i < textLength; i++) {
         char zoneNameChar = *text;
         bool isValidZoneChar = isalnum(zoneNameChar) || zoneNameChar == '/' || zoneNameChar == '-' || zoneNameChar == '_';
         if (!isValidZoneChar) {
             break;
         }
-        zoneNameBuffer[i] = zoneNameChar;
         text++;
     }
 
-    const TimeZone *zoneId = findTimeZone(zoneNameBuffer);
+    const TimeZone *zoneId = findTimeZoneWithLength(textStart, text - textStart);
     if (zoneId != NULL) {
         zone->id = zoneId->id;
         zone->utcOffset = zoneId->utcOffset;
         zone->names = zoneId->names;
         zone->rules = zoneId->rules;
+        zone->ruleCount = zoneId->ruleCount;
+        zone->recurringRule = zoneId->recurringRule;
+        return (text - textStart);
+    }
+    if (setZoneOfNameCandidates(textStart, text - textStart, zone, zoneName)) {    // abbreviation like "CEST"
         return (text - textStart);
     }
     return TEXT_NOT_PARSED;
 }
 
+static uint32_t parseZoneByLongName(const char *text, TimeZone *zone, const ZoneNameCandidate **zoneName) {
+    uint32_t length = 0;
+    while (length < ZONE_LONG_NAME_MAX_LENGTH && isZoneLongNameChar(text[length])) {
+        length++;
+    }
+    for (; length > 0; length--) {     // longest name first, name can end only at the end of word
+        bool isWordEnd = !isalnum((int) text[length]) && text[length - 1] != ' ';
+        if (isWordEnd && setZoneOfNameCandidates(text, length, zone, zoneName)) {
+            return length;
+        }
+    }
+    return TEXT_NOT_PARSED;
+}
+
+static bool isZoneLongNameChar(char nameChar) {     // such as in "Australian Central Standard Time (South Australia)"
+    return isalnum((int) nameChar) || (nameChar != '\0' && strchr(" ()-.'", nameChar) != NULL);
+}
+
+static bool setZoneOfNameCandidates(const char *name, uint32_t length, TimeZone *zone, const ZoneNameCandidate **zoneName) {
+    const ZoneNameCandidate *candidates = NULL;
+    uint8_t candidateCount = findZoneNameCandidates(name, length, &candidates);
+    for (uint8_t i = 0; i < candidateCount; i++) {  // zone of the first candidate may be not compiled into subset
+        const TimeZone *candidateZone = findTimeZone(candidates[i].zoneId);
+        if (candidateZone != NULL) {
+            *zone = *candidateZone;
+            if (zoneName != NULL) {     // offset is resolved from all candidates when date-time is parsed
+                *zoneName = candidates;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+/* First candidate zone that has the named offset and daylight time at the parsed local date-time, in overlap the named offset selects the instant*/
+static ZonedDateTime zonedDateTimeOfZoneName(DateTime *dateTime, const ZoneNameCandidate *zoneName) {
+    for (uint8_t i = 0; i < zoneName->candidateCount; i++) {
+        const ZoneNameCandidate *candidate = &zoneName[i];
+        const TimeZone *candidateZone = findTimeZone(candidate->zoneId);
+        if (candidateZone == NULL) continue;
+
+        ZonedDateTime zonedDateTime = zonedDateTimeOfDateTimeWithOffset(dateTime, candidateZone, candidate->offset);
+        if (isDateTimeValid(&zonedDateTime.dateTime) &&
+            isTimeZoneDaylightTime(dateTimeToEpochSecond(dateTime, candidate->offset), candidateZone) == candidate->isDaylightTime) {
+            return zonedDateTime;
+        }
+    }
+    return UNINITIALIZED_ZONED_DATE_TIME;
+}
+
 static int64_t extractTemporalNumber(TemporalField *temporal, const char *text, uint8_t *parsedLength) {
     static char buffer[16];
     memset(buffer, 0, 16);
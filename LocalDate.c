@@ -2,49 +2,93 @@
 
 #define UNINITIALIZED_DATE ((Date){.year = -1, .month = 0, .day = -1})
 
+#define DAYS_0000_TO_MARCH 60       // year zero is leap
+#define EPOCH_SHIFT_YEARS 1000000000LL      // multiple of 400 years, so whole EPOCH_DAY_RANGE is not negative after shift
+#define EPOCH_SHIFT_DAYS (EPOCH_SHIFT_YEARS / 400 * DAYS_PER_CYCLE)     // 400 year cycle is whole weeks too
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DATE_BATCH_X86_KERNELS      // compiled with target attributes, selected at runtime
+#include <immintrin.h>
+#endif
+
+// Batch kernels shift epoch day by fewer years, so march day of about +-1.4 million years fits 30 bits of 32-bit lane
+#define BATCH_SHIFT_YEARS 1400000
+#define BATCH_SHIFT_DAYS (BATCH_SHIFT_YEARS / 400 * DAYS_PER_CYCLE)
+#define BATCH_MARCH_DAY_OFFSET (DAYS_0000_TO_1970 - DAYS_0000_TO_MARCH + BATCH_SHIFT_DAYS)
+#define BATCH_MARCH_DAY_LIMIT (1U << 30)    // so 4 * march day + 3 is 32-bit
+#define BATCH_WEEK_DAY_OFFSET 2             // (march day + 2) % 7 is (epoch day + 3) % 7
+#define BATCH_CENTURY_MAGIC 963315389U      // n / 146097 == mulhi(n, magic) >> 15 for any 32-bit n
+#define BATCH_CENTURY_SHIFT 15
+#define BATCH_WEEK_MAGIC 613566757U         // n / 7 == mulhi(n, magic) for n below 2^30 + 7
+
 static Date * setDate(Date *date, int64_t year, Month month, uint8_t dayOfMonth);
+static Date * setDateOfEpochDay(Date *date, int64_t year, Month month, uint8_t dayOfMonth, int64_t epochDay);
+static DayOfWeek dayOfWeekOfEpochDay(int64_t epochDay);
+static inline int64_t epochDayOfValidDate(int64_t year, Month month, uint8_t dayOfMonth);
+static inline int64_t civilDateOfEpochDay(int64_t epochDay, uint32_t *month, uint32_t *dayOfMonth);
+static DateBatchKernel supportedDateBatchKernel();
+static void dateOfEpochDayBatchScalar(const int32_t *epochDays, size_t count, int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays);
+#ifdef DATE_BATCH_X86_KERNELS
+static size_t dateOfEpochDayBatchAvx2(const int32_t *epochDays, size_t count, int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays);
+static size_t dateOfEpochDayBatchAvx512(const int32_t *epochDays, size_t count, int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays);
+#endif
 static bool isProvidedDateValid(int64_t year, Month month, uint8_t dayOfMonth);
 static Date * resolvePreviousValidDate(Date *date, int64_t year, Month month, uint8_t day);
 static Month monthPlus(Month month, uint8_t months);
 
 
 Date dateOf(int64_t year, Month month, uint8_t dayOfMonth) {
-    Date date = UNINITIALIZED_DATE;
-    return isProvidedDateValid(year, month, dayOfMonth) ? *setDate(&date, year, month, dayOfMonth) : date;
+    if (!isProvidedDateValid(year, month, dayOfMonth)) return UNINITIALIZED_DATE;
+    Date date;
+    return *setDate(&date, year, month, dayOfMonth);
 }
 
 Date dateOfEpochDay(int64_t epochDay) {
     if (isValidValue(&EPOCH_DAY_RANGE, epochDay)) {
-        int64_t zeroDay = epochDay + DAYS_0000_TO_1970;
-        // find the march-based year
-        zeroDay -= 60;  // adjust to 0000-03-01 so leap day is at end of four-year cycle
-        int64_t adjust = 0;
-        if (zeroDay < 0) {
-            // adjust negative years to positive for calculation
-            int64_t adjustCycles = (zeroDay + 1) / DAYS_PER_CYCLE - 1;
-            adjust = adjustCycles * 400;
-            zeroDay += -adjustCycles * DAYS_PER_CYCLE;
-        }
-        int64_t yearEst = (400 * zeroDay + 591) / DAYS_PER_CYCLE;
-        int64_t doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
-        if (doyEst < 0) {
-            yearEst--;// fix estimate
-            doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
+        uint32_t month;
+        uint32_t dayOfMonth;
+        int64_t year = civilDateOfEpochDay(epochDay, &month, &dayOfMonth);
+        if (isValidValue(&YEAR_RANGE, year)) {
+            Date date;
+            return *setDateOfEpochDay(&date, year, month, dayOfMonth, epochDay);    // always valid, epoch day gives week day
         }
-        yearEst += adjust;  // reset any negative year
-        uint32_t marchDoy0 = (uint32_t) doyEst;
+    }
+    return UNINITIALIZED_DATE;
+}
 
-        // convert march-based values back to january-based
-        uint32_t marchMonth0 = (marchDoy0 * 5 + 2) / 153;
-        uint32_t month = (marchMonth0 + 2) % 12 + 1;
-        uint32_t dayOfMonth = marchDoy0 - (marchMonth0 * 306 + 5) / 10 + 1;
-        yearEst += marchMonth0 / 10;
+DateBatchKernel detectDateBatchKernel() {
+#ifdef DATE_BATCH_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return DATE_BATCH_AVX512;
+    if (__builtin_cpu_supports("avx2")) return DATE_BATCH_AVX2;
+#endif
+    return DATE_BATCH_SCALAR;
+}
 
-        if (isValidValue(&YEAR_RANGE, yearEst)) {
-            return dateOf(yearEst, month, dayOfMonth);
-        }
+void dateOfEpochDayBatch(const int32_t *epochDays, size_t count, int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays) {
+    dateOfEpochDayBatchWithKernel(supportedDateBatchKernel(), epochDays, count, years, months, days, weekDays);
+}
+
+void dateOfEpochDayBatchWithKernel(DateBatchKernel kernel, const int32_t *epochDays, size_t count,
+                                   int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays) {
+    if (epochDays == NULL || years == NULL || months == NULL || days == NULL || weekDays == NULL) return;
+    DateBatchKernel supportedKernel = supportedDateBatchKernel();
+    kernel = (kernel > supportedKernel) ? supportedKernel : kernel;
+
+    size_t converted = 0;
+    switch (kernel) {
+#ifdef DATE_BATCH_X86_KERNELS
+        case DATE_BATCH_AVX512:
+            converted = dateOfEpochDayBatchAvx512(epochDays, count, years, months, days, weekDays);
+            break;
+        case DATE_BATCH_AVX2:
+            converted = dateOfEpochDayBatchAvx2(epochDays, count, years, months, days, weekDays);
+            break;
+#endif
+        default:
+            break;
     }
-    return UNINITIALIZED_DATE;
+    dateOfEpochDayBatchScalar(epochDays + converted, count - converted, years + converted, months + converted, days + converted, weekDays + converted);
 }
 
 Date dateOfYearDay(uint32_t year, uint32_t dayOfYear) {
@@ -73,26 +117,17 @@ Date dateOfInstant(Instant *instant, const TimeZone *zone) {
     return UNINITIALIZED_DATE;
 }
 
+PackedDate packDate(const Date *date) {
+    if (!isDateValid(date) || date->year < PACKED_DATE_MIN_YEAR || date->year > PACKED_DATE_MAX_YEAR) return PACKED_DATE_INVALID;
+    return ((uint32_t) (date->year + PACKED_DATE_YEAR_BIAS) << 9) | ((uint32_t) date->month << 5) | (uint32_t) date->day;
+}
+
+Date unpackDate(PackedDate packedDate) {
+    return dateOf((int64_t) (packedDate >> 9) - PACKED_DATE_YEAR_BIAS, (packedDate >> 5) & 0xF, packedDate & 0x1F);
+}
+
 int64_t dateToEpochDay(Date *date) {
-    if (!isDateValid(date)) return INT64_MIN;
-    int64_t year = date->year;
-    int64_t month = date->month;
-    int64_t total = 0;
-    total += 365 * year;
-    if (year >= 0) {
-        total += (year + 3) / 4 - (year + 99) / 100 + (year + 399) / 400;
-    } else {
-        total -= year / -4 - year / -100 + year / -400;
-    }
-    total += ((367 * month - 362) / 12);
-    total += date->day - 1;
-    if (month > 2) {
-        total--;
-        if (!isLeapYear(date->year)) {
-            total--;
-        }
-    }
-    return total - DAYS_0000_TO_1970;
+    return isDateValid(date) ? epochDayOfValidDate(date->year, date->month, date->day) : INT64_MIN;
 }
 
 int64_t dateToEpochSeconds(Date *date, Time *time, const TimeZone *zone) {
@@ -131,29 +166,29 @@ Date *datePlusWeeks(Date *date, int64_t weeksToAdd) {
 
 Date *datePlusDays(Date *date, int64_t daysToAdd) {
     if (!isDateValid(date)) return date;
+    int64_t epochDay = dateToEpochDay(date) + daysToAdd;    // only conversion to epoch day, week day is taken from it
     int64_t totalDays = date->day + daysToAdd;
     if (totalDays > 0) {
         if (totalDays <= 28) {
-            return setDate(date, date->year, date->month, totalDays);
+            return setDateOfEpochDay(date, date->year, date->month, totalDays, epochDay);
 
         } else if (totalDays <= 59) { // 59th Jan is 28th Feb, 59th Feb is 31st Mar
             uint8_t monthLength = lengthOfMonth(date->month, isLeapYear(date->year));
             if (totalDays <= monthLength) {
-                return setDate(date, date->year, date->month, totalDays);
+                return setDateOfEpochDay(date, date->year, date->month, totalDays, epochDay);
 
             } else if (date->month < 12) {
-                return setDate(date, date->year, date->month + 1, totalDays - monthLength);
+                return setDateOfEpochDay(date, date->year, date->month + 1, totalDays - monthLength, epochDay);
 
             } else {
                 if (isValidValue(&YEAR_RANGE, date->year + 1)) {
-                    return setDate(date, date->year + 1, 1, (totalDays - monthLength));
+                    return setDateOfEpochDay(date, date->year + 1, 1, (totalDays - monthLength), epochDay);
                 }
             }
         }
     }
 
-    int64_t mjDay = dateToEpochDay(date) + daysToAdd;
-    Date tmpDate = dateOfEpochDay(mjDay);
+    Date tmpDate = dateOfEpochDay(epochDay);
     if (isDateValid(&tmpDate)) {
         date->year = tmpDate.year;
         date->month = tmpDate.month;
@@ -214,8 +249,7 @@ uint16_t getDayOfYear(Date *date) {
 
 DayOfWeek getDayOfWeek(Date *date) {            // find day of week from a given date
     if (!isDateValid(date)) return 0;
-    int64_t dayOfWeek = floorMod(dateToEpochDay(date) + 3, 7);
-    return dayOfWeek + 1;
+    return dayOfWeekOfEpochDay(dateToEpochDay(date));
 }
 
 uint8_t getWeekOfYear(Date *date) {
@@ -236,62 +270,6 @@ uint16_t getLengthOfYear(int64_t year) {
     return isLeapYear(year) ? 366 : 365;
 }
 
-bool isLeapYear(int64_t year) {
-    return (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0));
-}
-
-uint32_t firstDayOfYearByMonth(Month month, bool leapYear) {
-    switch (month) {
-        case JANUARY:
-            return 1;
-        case FEBRUARY:
-            return 32;
-        case MARCH:
-            return 60 + leapYear;
-        case APRIL:
-            return 91 + leapYear;
-        case MAY:
-            return 121 + leapYear;
-        case JUNE:
-            return 152 + leapYear;
-        case JULY:
-            return 182 + leapYear;
-        case AUGUST:
-            return 213 + leapYear;
-        case SEPTEMBER:
-            return 244 + leapYear;
-        case OCTOBER:
-            return 274 + leapYear;
-        case NOVEMBER:
-            return 305 + leapYear;
-        case DECEMBER:
-        default:
-            return 335 + leapYear;
-    }
-}
-
-int8_t lengthOfMonth(Month month, bool leapYear) {
-    switch (month) {
-        case FEBRUARY:
-            return leapYear ? 29 : 28;
-        case APRIL:
-        case JUNE:
-        case SEPTEMBER:
-        case NOVEMBER:
-            return 30;
-        case JANUARY:
-        case MARCH:
-        case MAY:
-        case JULY:
-        case AUGUST:
-        case OCTOBER:
-        case DECEMBER:
-            return 31;
-        default:
-            return -1;
-    }
-}
-
 bool isDateValid(const Date *date) {
     return date != NULL && isProvidedDateValid(date->year, date->month, date->day);
 }
@@ -300,51 +278,184 @@ static Date *setDate(Date *date, int64_t year, Month month, uint8_t dayOfMonth)
     date->year = year;
     date->month = month;
     date->day = (int8_t) dayOfMonth;
-    date->weekDay = getDayOfWeek(date);
+    date->weekDay = dayOfWeekOfEpochDay(epochDayOfValidDate(year, month, dayOfMonth));     // callers pass valid date
     return date;
 }
 
-static bool isProvidedDateValid(int64_t year, Month month, uint8_t dayOfMonth) {
-    if (isValidValue(&YEAR_RANGE, year) && isValidValue(&MONTH_OF_YEAR_RANGE, month) && isValidValue(&DAY_OF_MONTH_RANGE, dayOfMonth)) {
-        if (dayOfMonth > 28) {
-            uint8_t dom = 31;
-            switch (month) {
-                case FEBRUARY:
-                    dom = isLeapYear(year) ? 29 : 28;
-                    break;
-                case APRIL:
-                case JUNE:
-                case SEPTEMBER:
-                case NOVEMBER:
-                    dom = 30;
-                    break;
-                default:
-                    break;
-            }
-            if (dayOfMonth > dom) return false;
-            return true;
+static Date *setDateOfEpochDay(Date *date, int64_t year, Month month, uint8_t dayOfMonth, int64_t epochDay) {
+    date->year = year;
+    date->month = month;
+    date->day = (int8_t) dayOfMonth;
+    date->weekDay = dayOfWeekOfEpochDay(epochDay);
+    return date;
+}
+
+static DayOfWeek dayOfWeekOfEpochDay(int64_t epochDay) {    // 1970-01-01 is Thursday, shift is whole weeks
+    return (DayOfWeek) ((uint64_t) (epochDay + EPOCH_SHIFT_DAYS + 3) % 7 + 1);
+}
+
+static inline int64_t epochDayOfValidDate(int64_t year, Month month, uint8_t dayOfMonth) {
+    // Neri-Schneider: January and February are the last months of shifted march-based year
+    uint32_t isJanuaryOrFebruary = month <= FEBRUARY;
+    uint64_t marchYear = (uint64_t) (year + EPOCH_SHIFT_YEARS) - isJanuaryOrFebruary;
+    uint32_t marchMonth = month + 12 * isJanuaryOrFebruary;
+    uint64_t century = marchYear / 100;
+    uint64_t yearDays = 1461 * marchYear / 4 - century + century / 4;
+    uint32_t monthDays = (979 * marchMonth - 2919) / 32;
+    int64_t marchDay = (int64_t) (yearDays + monthDays + dayOfMonth - 1) - EPOCH_SHIFT_DAYS;
+    return marchDay + DAYS_0000_TO_MARCH - DAYS_0000_TO_1970;
+}
+
+/* Neri-Schneider: day of shifted march-based calendar, so all values are unsigned and divisors are constants.
+ * Epoch day should be in EPOCH_DAY_RANGE, returns proleptic year*/
+static inline int64_t civilDateOfEpochDay(int64_t epochDay, uint32_t *month, uint32_t *dayOfMonth) {
+    uint64_t marchDay = (uint64_t) (epochDay + DAYS_0000_TO_1970 - DAYS_0000_TO_MARCH + EPOCH_SHIFT_DAYS);
+    uint64_t cycleQuarters = 4 * marchDay + 3;
+    uint64_t century = cycleQuarters / DAYS_PER_CYCLE;    // quarter days of century are days of 400 year cycle
+    uint64_t centuryDay = (cycleQuarters % DAYS_PER_CYCLE) | 3;     // 4 * day of century + 3
+    uint64_t yearFraction = 2939745ULL * centuryDay;
+    uint64_t yearOfCentury = yearFraction >> 32;
+    uint32_t marchDoy0 = (uint32_t) yearFraction / 2939745 / 4;
+
+    uint32_t monthFraction = 2141 * marchDoy0 + 197913;
+    uint32_t isJanuaryOrFebruary = marchDoy0 >= 306;
+    *month = (monthFraction >> 16) - 12 * isJanuaryOrFebruary;
+    *dayOfMonth = (monthFraction & 0xFFFF) / 2141 + 1;
+    return (int64_t) (100 * century + yearOfCentury) - EPOCH_SHIFT_YEARS + isJanuaryOrFebruary;
+}
+
+static DateBatchKernel supportedDateBatchKernel() {
+    static int32_t detectedKernel = -1;     // detected once, same value for concurrent first calls
+    int32_t kernel = __atomic_load_n(&detectedKernel, __ATOMIC_RELAXED);
+    if (kernel < 0) {
+        kernel = (int32_t) detectDateBatchKernel();
+        __atomic_store_n(&detectedKernel, kernel, __ATOMIC_RELAXED);
+    }
+    return (DateBatchKernel) kernel;
+}
+
+static void dateOfEpochDayBatchScalar(const int32_t *epochDays, size_t count, int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays) {
+    for (size_t i = 0; i < count; i++) {    // 32-bit epoch day is always in EPOCH_DAY_RANGE and YEAR_RANGE
+        uint32_t month;
+        uint32_t dayOfMonth;
+        years[i] = (int32_t) civilDateOfEpochDay(epochDays[i], &month, &dayOfMonth);
+        months[i] = (uint8_t) month;
+        days[i] = (uint8_t) dayOfMonth;
+        weekDays[i] = (uint8_t) dayOfWeekOfEpochDay(epochDays[i]);
+    }
+}
+
+#ifdef DATE_BATCH_X86_KERNELS
+/* Same steps as civilDateOfEpochDay() in 32-bit lanes: century division is multiply-shift, day of year is day of century
+ * less days of previous years, day of month is day of year less days of previous months of march-based year.
+ * Vector with march day out of 30 bits is converted by scalar loop, so results are always the same as dateOfEpochDay()*/
+__attribute__((target("avx2")))
+static inline __m256i mulhiEpu32Avx2(__m256i value, __m256i multiplier) {
+    __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(value, multiplier), 32);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), multiplier);
+    return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+__attribute__((target("avx2")))
+static inline void storeBytesAvx2(uint8_t *bytes, __m256i value) {     // low byte of each lane
+    __m256i laneBytes = _mm256_shuffle_epi8(value, _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                                     0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+    __m256i packed = _mm256_permutevar8x32_epi32(laneBytes, _mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1));
+    _mm_storel_epi64((__m128i *) bytes, _mm256_castsi256_si128(packed));
+}
+
+__attribute__((target("avx2")))
+static size_t dateOfEpochDayBatchAvx2(const int32_t *epochDays, size_t count, int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays) {
+    const __m256i outOfRangeBits = _mm256_set1_epi32((int32_t) -BATCH_MARCH_DAY_LIMIT);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i marchDay = _mm256_add_epi32(_mm256_loadu_si256((const __m256i *) &epochDays[i]), _mm256_set1_epi32(BATCH_MARCH_DAY_OFFSET));
+        if (!_mm256_testz_si256(marchDay, outOfRangeBits)) {
+            dateOfEpochDayBatchScalar(&epochDays[i], 8, &years[i], &months[i], &days[i], &weekDays[i]);
+            continue;
         }
-        return true;
+        __m256i cycleQuarters = _mm256_add_epi32(_mm256_slli_epi32(marchDay, 2), _mm256_set1_epi32(3));
+        __m256i century = _mm256_srli_epi32(mulhiEpu32Avx2(cycleQuarters, _mm256_set1_epi32((int32_t) BATCH_CENTURY_MAGIC)), BATCH_CENTURY_SHIFT);
+        __m256i centuryDay = _mm256_or_si256(_mm256_sub_epi32(cycleQuarters, _mm256_mullo_epi32(century, _mm256_set1_epi32(DAYS_PER_CYCLE))),
+                                             _mm256_set1_epi32(3));
+        __m256i yearOfCentury = mulhiEpu32Avx2(centuryDay, _mm256_set1_epi32(2939745));
+        __m256i marchDoy0 = _mm256_sub_epi32(_mm256_srli_epi32(centuryDay, 2),
+                                             _mm256_srli_epi32(_mm256_mullo_epi32(yearOfCentury, _mm256_set1_epi32(1461)), 2));
+
+        __m256i marchMonth = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi32(marchDoy0, _mm256_set1_epi32(2141)), _mm256_set1_epi32(197913)), 16);
+        __m256i monthDays = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_mullo_epi32(marchMonth, _mm256_set1_epi32(979)), _mm256_set1_epi32(2919)), 5);
+        __m256i isJanuaryOrFebruary = _mm256_cmpgt_epi32(marchDoy0, _mm256_set1_epi32(305));     // all bits set
+        __m256i month = _mm256_sub_epi32(marchMonth, _mm256_and_si256(isJanuaryOrFebruary, _mm256_set1_epi32(12)));
+        __m256i dayOfMonth = _mm256_add_epi32(_mm256_sub_epi32(marchDoy0, monthDays), _mm256_set1_epi32(1));
+        __m256i year = _mm256_add_epi32(_mm256_mullo_epi32(century, _mm256_set1_epi32(100)), yearOfCentury);
+        year = _mm256_sub_epi32(_mm256_sub_epi32(year, _mm256_set1_epi32(BATCH_SHIFT_YEARS)), isJanuaryOrFebruary);
+
+        __m256i weekDay = _mm256_add_epi32(marchDay, _mm256_set1_epi32(BATCH_WEEK_DAY_OFFSET));
+        __m256i weeks = mulhiEpu32Avx2(weekDay, _mm256_set1_epi32((int32_t) BATCH_WEEK_MAGIC));
+        weekDay = _mm256_add_epi32(_mm256_sub_epi32(weekDay, _mm256_mullo_epi32(weeks, _mm256_set1_epi32(7))), _mm256_set1_epi32(1));
+
+        _mm256_storeu_si256((__m256i *) &years[i], year);
+        storeBytesAvx2(&months[i], month);
+        storeBytesAvx2(&days[i], dayOfMonth);
+        storeBytesAvx2(&weekDays[i], weekDay);
     }
-    return false;
+    return i;
 }
 
+__attribute__((target("avx512f")))
+static inline __m512i mulhiEpu32Avx512(__m512i value, __m512i multiplier) {
+    __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(value, multiplier), 32);
+    __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(value, 32), multiplier);
+    return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+}
 
-static Date *resolvePreviousValidDate(Date *date, int64_t year, Month month, uint8_t day) {
-    switch (month) {
-        case FEBRUARY:
-            day = minInt64(day, isLeapYear(year) ? 29 : 28);
-            break;
-        case APRIL:
-        case JUNE:
-        case SEPTEMBER:
-        case NOVEMBER:
-            day = minInt64(day, 30);
-            break;
-        default:
-            break;
+__attribute__((target("avx512f")))
+static size_t dateOfEpochDayBatchAvx512(const int32_t *epochDays, size_t count, int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays) {
+    const __m512i outOfRangeBits = _mm512_set1_epi32((int32_t) -BATCH_MARCH_DAY_LIMIT);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512i marchDay = _mm512_add_epi32(_mm512_loadu_si512(&epochDays[i]), _mm512_set1_epi32(BATCH_MARCH_DAY_OFFSET));
+        if (_mm512_test_epi32_mask(marchDay, outOfRangeBits) != 0) {
+            dateOfEpochDayBatchScalar(&epochDays[i], 16, &years[i], &months[i], &days[i], &weekDays[i]);
+            continue;
+        }
+        __m512i cycleQuarters = _mm512_add_epi32(_mm512_slli_epi32(marchDay, 2), _mm512_set1_epi32(3));
+        __m512i century = _mm512_srli_epi32(mulhiEpu32Avx512(cycleQuarters, _mm512_set1_epi32((int32_t) BATCH_CENTURY_MAGIC)), BATCH_CENTURY_SHIFT);
+        __m512i centuryDay = _mm512_or_si512(_mm512_sub_epi32(cycleQuarters, _mm512_mullo_epi32(century, _mm512_set1_epi32(DAYS_PER_CYCLE))),
+                                             _mm512_set1_epi32(3));
+        __m512i yearOfCentury = mulhiEpu32Avx512(centuryDay, _mm512_set1_epi32(2939745));
+        __m512i marchDoy0 = _mm512_sub_epi32(_mm512_srli_epi32(centuryDay, 2),
+                                             _mm512_srli_epi32(_mm512_mullo_epi32(yearOfCentury, _mm512_set1_epi32(1461)), 2));
+
+        __m512i marchMonth = _mm512_srli_epi32(_mm512_add_epi32(_mm512_mullo_epi32(marchDoy0, _mm512_set1_epi32(2141)), _mm512_set1_epi32(197913)), 16);
+        __m512i monthDays = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_mullo_epi32(marchMonth, _mm512_set1_epi32(979)), _mm512_set1_epi32(2919)), 5);
+        __mmask16 isJanuaryOrFebruary = _mm512_cmpgt_epu32_mask(marchDoy0, _mm512_set1_epi32(305));
+        __m512i month = _mm512_mask_sub_epi32(marchMonth, isJanuaryOrFebruary, marchMonth, _mm512_set1_epi32(12));
+        __m512i dayOfMonth = _mm512_add_epi32(_mm512_sub_epi32(marchDoy0, monthDays), _mm512_set1_epi32(1));
+        __m512i year = _mm512_add_epi32(_mm512_mullo_epi32(century, _mm512_set1_epi32(100)), yearOfCentury);
+        year = _mm512_sub_epi32(year, _mm512_set1_epi32(BATCH_SHIFT_YEARS));
+        year = _mm512_mask_add_epi32(year, isJanuaryOrFebruary, year, _mm512_set1_epi32(1));
+
+        __m512i weekDay = _mm512_add_epi32(marchDay, _mm512_set1_epi32(BATCH_WEEK_DAY_OFFSET));
+        __m512i weeks = mulhiEpu32Avx512(weekDay, _mm512_set1_epi32((int32_t) BATCH_WEEK_MAGIC));
+        weekDay = _mm512_add_epi32(_mm512_sub_epi32(weekDay, _mm512_mullo_epi32(weeks, _mm512_set1_epi32(7))), _mm512_set1_epi32(1));
+
+        _mm512_storeu_si512(&years[i], year);
+        _mm_storeu_si128((__m128i *) &months[i], _mm512_cvtepi32_epi8(month));
+        _mm_storeu_si128((__m128i *) &days[i], _mm512_cvtepi32_epi8(dayOfMonth));
+        _mm_storeu_si128((__m128i *) &weekDays[i], _mm512_cvtepi32_epi8(weekDay));
     }
-    return setDate(date, year, month, day);
+    return i;
+}
+#endif
+
+static bool isProvidedDateValid(int64_t year, Month month, uint8_t dayOfMonth) {
+    return isValidValue(&YEAR_RANGE, year) && isValidValue(&MONTH_OF_YEAR_RANGE, month) &&
+           dayOfMonth >= DAY_OF_MONTH_RANGE.min && dayOfMonth <= MONTH_LENGTH[isLeapYear(year)][month];
+}
+
+static Date *resolvePreviousValidDate(Date *date, int64_t year, Month month, uint8_t day) {
+    return setDate(date, year, month, minInt64(day, lengthOfMonth(month, isLeapYear(year))));
 }
 
 static Month monthPlus(Month month, uint8_t months) {
@@ -166,6 +166,20 @@ bool isDateTimeValid(DateTime *dateTime) {
     return dateTime != NULL && isDateValid(&dateTime->date) && isTimeValid(&dateTime->time);
 }
 
+PackedDateTime packDateTime(const DateTime *dateTime) {
+    if (dateTime == NULL || !isDateValid(&dateTime->date) || !isTimeValid(&dateTime->time)) return PACKED_DATE_TIME_INVALID;
+    const Date *date = &dateTime->date;
+    const Time *time = &dateTime->time;
+    return ((uint64_t) (date->year + PACKED_DATE_TIME_YEAR_BIAS) << 36) | ((uint64_t) date->month << 32) | ((uint64_t) date->day << 27) |
+           ((uint64_t) time->hours << 22) | ((uint64_t) time->minutes << 16) | ((uint64_t) time->seconds << 10) | (uint64_t) time->millis;
+}
+
+DateTime unpackDateTime(PackedDateTime packedDateTime) {
+    return dateTimeOfWithMillis((int64_t) (packedDateTime >> 36) - PACKED_DATE_TIME_YEAR_BIAS, (packedDateTime >> 32) & 0xF,
+                                (packedDateTime >> 27) & 0x1F, (packedDateTime >> 22) & 0x1F, (packedDateTime >> 16) & 0x3F,
+                                (packedDateTime >> 10) & 0x3F, packedDateTime & 0x3FF);
+}
+
 /* Combines result for this DateTime with the specified period added.
  * Params:
  *  date – the date to base the calculation on
@@ -35,10 +35,12 @@ static DateTime DATE_TIME_2001_7_22_18_8_56_576 = {
         .date = {.year = 2001, .month = 7, .day = 22, .weekDay = WEDNESDAY},
         .time = {.hours = 18, .minutes = 8, .seconds = 56, .millis = 576}};
 
-static ZonedDateTime ZDT_2001_7_4_12_8_56_456_LOS_ANGELES = {
+static const TimeZone LOS_ANGELES_USER_ZONE = {.id = "America/Los_Angeles", .utcOffset = -28800, .names = PST_ZONE_NAMES, .rules = AMERICA_LOS_ANGELES_RULES};
+
+static ZonedDateTime ZDT_2001_7_4_12_8_56_456_LOS_ANGELES = {    // zone handle is set by test
         .dateTime.date = {.year = 2001, .month = 7, .day = 4, .weekDay = WEDNESDAY},
         .dateTime.time = {.hours = 12, .minutes = 8, .seconds = 56, .millis = 567},
-        .zone = {.id = "America/Los_Angeles", .utcOffset = -28800, .names = PST_ZONE_NAMES, .rules = AMERICA_LOS_ANGELES_RULES}};
+        .zone = ZONE_HANDLE_NONE};
 
 static const ZoneTest TIME_ZONE_PARSE_TEST[] = {
         {.text = "Z", .id = "UTC", .offset = 0},
@@ -275,6 +277,8 @@ static MunitResult testDateTimeFormat(const MunitParameter params[], void *data)
 static MunitResult testZDTFormatPattern(const MunitParameter params[], void *data) {
     DateTimeFormatter formatter;
     char buffer[64];
+    ZDT_2001_7_4_12_8_56_456_LOS_ANGELES.zone = zoneHandleOf(&LOS_ANGELES_USER_ZONE);
+    ZDT_2001_7_4_12_8_56_456_LOS_ANGELES.externalZone = &LOS_ANGELES_USER_ZONE;
     for (int i = 0; i < ARRAY_SIZE(ZONED_DATE_TIME_FORMAT_PATTERN_TEST); i++) {
         const char *pattern = ZONED_DATE_TIME_FORMAT_PATTERN_TEST[i].pattern;
         parseDateTimePattern(&formatter, pattern);
@@ -403,7 +407,7 @@ static MunitResult testZDTParseByPattern(const MunitParameter params[], void *da
                 ZONED_DATE_TIME_PARSE_TEST[i].dtValues[5],
                 ZONED_DATE_TIME_PARSE_TEST[i].dtValues[6]);
         assertDateTimeEquals(test.dateTime, expected);
-        assert_int(test.zone.utcOffset, ==, ZONED_DATE_TIME_PARSE_TEST[i].dtValues[7]);
+        assert_int(getZonedDateTimeZone(&test).utcOffset, ==, ZONED_DATE_TIME_PARSE_TEST[i].dtValues[7]);
     }
     return MUNIT_OK;
 }
@@ -448,14 +452,73 @@ static MunitResult testZDTDstCheck(const MunitParameter params[], void *data) {
     ZonedDateTime winter = parseToZonedDateTime("2021-11-27 09:00:00 [Europe/Amsterdam]", &parser);
     ZonedDateTime summer = parseToZonedDateTime("2021-03-28 09:00:00 [Europe/Amsterdam]", &parser);
 
-    assert_true(winter.zone.utcOffset == 7200);
+    assert_true(getZonedDateTimeZone(&winter).utcOffset == 7200);
     assert_true(winter.offset == 3600);
 
-    assert_true(summer.zone.utcOffset == 7200);
+    assert_true(getZonedDateTimeZone(&summer).utcOffset == 7200);
     assert_true(summer.offset == 7200);
     return MUNIT_OK;
 }
 
+static MunitResult testZDTParseZoneName(const MunitParameter params[], void *data) {
+    DateTimeFormatter parser;
+    parseDateTimePattern(&parser, "yyyy-MM-dd HH:mm:ss z");
+    assert_true(parser.isFormatValid);
+    ZonedDateTime test = parseToZonedDateTime("2021-07-01 09:00:00 PDT", &parser);
+    assert_true(isDateTimeValid(&test.dateTime));
+    assert_string_equal(getZonedDateTimeZone(&test).id, "America/Los_Angeles");
+    assert_int32(test.offset, ==, -25200);
+
+    test = parseToZonedDateTime("2021-11-07 01:30:00 PST", &parser);  // overlap, name selects the later offset
+    assert_int8(test.dateTime.time.hours, ==, 1);
+    assert_string_equal(getZonedDateTimeZone(&test).id, "America/Los_Angeles");
+    assert_int32(test.offset, ==, -28800);
+    test = parseToZonedDateTime("2021-11-07 01:30:00 PDT", &parser);  // and the earlier one
+    assert_int8(test.dateTime.time.hours, ==, 1);
+    assert_string_equal(getZonedDateTimeZone(&test).id, "America/Los_Angeles");
+    assert_int32(test.offset, ==, -25200);
+
+    test = parseToZonedDateTime("2021-01-15 09:00:00 PDT", &parser);  // out of season
+    assert_false(isDateTimeValid(&test.dateTime));
+    test = parseToZonedDateTime("2021-03-14 02:30:00 PST", &parser);  // gap, next zone with the same name is used
+    assert_string_equal(getZonedDateTimeZone(&test).id, "Asia/Manila");
+    assert_int32(test.offset, ==, 28800);
+
+    test = parseToZonedDateTime("2021-01-15 09:00:00 JST", &parser);
+    assert_string_equal(getZonedDateTimeZone(&test).id, "Asia/Tokyo");
+    assert_int32(test.offset, ==, 32400);
+
+    test = parseToZonedDateTime("2021-01-15 09:00:00 CET", &parser);  // zone id is resolved before abbreviation
+    assert_string_equal(getZonedDateTimeZone(&test).id, "CET");
+
+    test = parseToZonedDateTime("2021-01-15 09:00:00 Europe/Amsterdam", &parser);   // zone id is still accepted
+    assert_string_equal(getZonedDateTimeZone(&test).id, "Europe/Amsterdam");
+
+    test = parseToZonedDateTime("2021-01-15 09:00:00 XYZT", &parser);
+    assert_false(isDateTimeValid(&test.dateTime));
+
+    parseDateTimePattern(&parser, "yyyy-MM-dd HH:mm:ss [zzzz]");
+    assert_true(parser.isFormatValid);
+    test = parseToZonedDateTime("2021-07-01 09:00:00 [Central European Summer Time]", &parser);
+    assert_true(isDateTimeValid(&test.dateTime));
+    assert_string_equal(getZonedDateTimeZone(&test).id, "Europe/Paris");
+    assert_int32(test.offset, ==, 7200);
+
+    test = parseToZonedDateTime("2021-07-01 09:00:00 [Central European Summer Times]", &parser);    // name ends at word end
+    assert_false(isDateTimeValid(&test.dateTime));
+    test = parseToZonedDateTime("2021-01-15 09:00:00 [Central European Summer Time]", &parser);
+    assert_false(isDateTimeValid(&test.dateTime));
+
+    parseDateTimePattern(&parser, "yyyy-MM-dd z");
+    assert_true(parser.isFormatValid);
+    test = parseToZonedDateTime("2021-07-15 PST", &parser);    // Philippine Standard Time, Pacific is on daylight time
+    assert_string_equal(getZonedDateTimeZone(&test).id, "Asia/Manila");
+    assert_int32(test.offset, ==, 28800);
+    test = parseToZonedDateTime("2021-07-15 PDT", &parser);
+    assert_int32(test.offset, ==, -25200);
+    return MUNIT_OK;
+}
+
 static MunitTest dateTimeFormatterTests[] = {
         {.name =  "Test timeZoneOf() - should correctly parse and return time zone", .test = testTimeZoneOf},
         {.name =  "Test parseDateTimePattern() - when invalid pattern should fail", .test = testInvalidFormatPattern},
@@ -472,6 +535,7 @@ static MunitTest dateTimeFormatterTests[] = {
         {.name =  "Test parseToZonedDateTime() - should correctly parse string to ZonedDateTime struct", .test = testZDTParseByPattern},
         {.name =  "Test parseToZonedDateTime() - check for parsing date-time conflicts", .test = testZDTParseConflicts},
         {.name =  "Test parseToZonedDateTime() - check for correct DST parsing", .test = testZDTDstCheck},
+        {.name =  "Test parseToZonedDateTime() - should parse zone abbreviation and long name", .test = testZDTParseZoneName},
         END_OF_TESTS
 };
 
@@ -124,6 +124,128 @@ static MunitResult testDateOfEpochDay(const MunitParameter params[], void *data)
     return MUNIT_OK;
 }
 
+static Date referenceDateOfEpochDay(int64_t epochDay) {     // previous algorithm with negative cycles adjustment
+    int64_t zeroDay = epochDay + DAYS_0000_TO_1970 - 60;
+    int64_t adjust = 0;
+    if (zeroDay < 0) {
+        int64_t adjustCycles = (zeroDay + 1) / DAYS_PER_CYCLE - 1;
+        adjust = adjustCycles * 400;
+        zeroDay += -adjustCycles * DAYS_PER_CYCLE;
+    }
+    int64_t yearEst = (400 * zeroDay + 591) / DAYS_PER_CYCLE;
+    int64_t doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
+    if (doyEst < 0) {
+        yearEst--;
+        doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
+    }
+    uint32_t marchMonth0 = ((uint32_t) doyEst * 5 + 2) / 153;
+    Date date = {.year = yearEst + adjust + marchMonth0 / 10, .month = (marchMonth0 + 2) % 12 + 1};
+    date.day = (int8_t) ((uint32_t) doyEst - (marchMonth0 * 306 + 5) / 10 + 1);
+    return date;
+}
+
+static int64_t referenceDateToEpochDay(const Date *date) {     // previous algorithm with year sign branches
+    int64_t year = date->year;
+    int64_t total = 365 * year + ((367 * (int64_t) date->month - 362) / 12) + date->day - 1;
+    if (year >= 0) {
+        total += (year + 3) / 4 - (year + 99) / 100 + (year + 399) / 400;
+    } else {
+        total -= year / -4 - year / -100 + year / -400;
+    }
+    if (date->month > 2) {
+        total -= isLeapYear(year) ? 1 : 2;
+    }
+    return total - DAYS_0000_TO_1970;
+}
+
+static void assertEpochDayConversion(int64_t epochDay) {
+    Date expected = referenceDateOfEpochDay(epochDay);
+    Date date = dateOfEpochDay(epochDay);
+    assert_int64(date.year, ==, expected.year);
+    assert_int(date.month, ==, expected.month);
+    assert_int(date.day, ==, expected.day);
+    assert_int(date.weekDay, ==, floorMod(epochDay + 3, 7) + 1);
+    assert_int64(dateToEpochDay(&date), ==, epochDay);
+    assert_int64(referenceDateToEpochDay(&date), ==, epochDay);
+}
+
+static MunitResult testEpochDayConversion(const MunitParameter params[], void *data) {
+    Date minDate = dateOf(YEAR_RANGE.min, 1, 1);
+    Date maxDate = dateOf(YEAR_RANGE.max, 12, 31);
+    int64_t minEpochDay = dateToEpochDay(&minDate);
+    int64_t maxEpochDay = dateToEpochDay(&maxDate);
+    assert_int64(minEpochDay, ==, referenceDateToEpochDay(&minDate));
+    assert_int64(maxEpochDay, ==, referenceDateToEpochDay(&maxDate));
+
+    // both algorithms repeat each 400 year cycle, so every day of cycles at range ends and around epoch is checked
+    for (int64_t i = 0; i < 2 * DAYS_PER_CYCLE; i++) {
+        assertEpochDayConversion(minEpochDay + i);
+        assertEpochDayConversion(maxEpochDay - i);
+        assertEpochDayConversion(i - DAYS_PER_CYCLE);
+    }
+    for (int64_t epochDay = minEpochDay; epochDay <= maxEpochDay; epochDay += 99991) {     // prime step over whole range
+        assertEpochDayConversion(epochDay);
+    }
+
+    Date invalidDate = dateOfEpochDay(minEpochDay - 1);
+    assert_false(isDateValid(&invalidDate));
+    invalidDate = dateOfEpochDay(maxEpochDay + 1);
+    assert_false(isDateValid(&invalidDate));
+    invalidDate = dateOfEpochDay(EPOCH_DAY_RANGE.min);
+    assert_false(isDateValid(&invalidDate));
+    invalidDate = dateOfEpochDay(EPOCH_DAY_RANGE.max);
+    assert_false(isDateValid(&invalidDate));
+    return MUNIT_OK;
+}
+
+#define BATCH_TEST_LENGTH 4099   // not multiple of vector length, so scalar tail is checked too
+
+static MunitResult testDateOfEpochDayBatch(const MunitParameter params[], void *data) {
+    static int32_t epochDays[BATCH_TEST_LENGTH];
+    static int32_t years[BATCH_TEST_LENGTH];
+    static uint8_t months[BATCH_TEST_LENGTH];
+    static uint8_t days[BATCH_TEST_LENGTH];
+    static uint8_t weekDays[BATCH_TEST_LENGTH];
+
+    const int32_t vectorRangeEnds[] = {-512058968, 561682855};    // ends of march day kept in 30 bits by SIMD kernels
+    uint32_t random = 12345;
+    for (int32_t i = 0; i < BATCH_TEST_LENGTH; i++) {
+        if (i < 2048) {
+            epochDays[i] = i - 1024;
+        } else if (i < 2112) {
+            epochDays[i] = vectorRangeEnds[(i - 2048) / 32] + (i - 2048) % 32 - 16;
+        } else {
+            random = random * 1103515245 + 12345;
+            epochDays[i] = (int32_t) random;
+        }
+    }
+    epochDays[3000] = INT32_MIN;
+    epochDays[3001] = INT32_MAX;
+
+    DateBatchKernel kernels[] = {DATE_BATCH_SCALAR, DATE_BATCH_AVX2, DATE_BATCH_AVX512};
+    for (int k = 0; k < ARRAY_SIZE(kernels); k++) {     // kernels not supported by CPU run as lower ones
+        memset(years, 0, sizeof(years));
+        memset(months, 0, sizeof(months));
+        memset(days, 0, sizeof(days));
+        memset(weekDays, 0, sizeof(weekDays));
+        dateOfEpochDayBatchWithKernel(kernels[k], epochDays, BATCH_TEST_LENGTH, years, months, days, weekDays);
+        for (int32_t i = 0; i < BATCH_TEST_LENGTH; i++) {
+            Date expected = dateOfEpochDay(epochDays[i]);
+            assert_int64(years[i], ==, expected.year);
+            assert_int(months[i], ==, expected.month);
+            assert_int(days[i], ==, expected.day);
+            assert_int(weekDays[i], ==, expected.weekDay);
+        }
+    }
+
+    dateOfEpochDayBatch(epochDays, 3, years, months, days, weekDays);
+    assert_int(years[0], ==, 1967);
+    assert_int(months[0], ==, MARCH);
+    assert_int(days[0], ==, 14);
+    assert_int(weekDays[0], ==, TUESDAY);
+    return MUNIT_OK;
+}
+
 static MunitResult testDateOfYearDay(const MunitParameter params[], void *data) {
     // non leap year
     Date test = dateOf(2007, 1, 1);
@@ -355,6 +477,14 @@ static MunitResult testDatePlusDays(const MunitParameter params[], void *data) {
     datePlusDays(&test, -1);         // too small
     assert_true(isDateValid(&test));
     assertDatesEquals(test, dateOf(YEAR_RANGE.min, 1, 1));
+
+    int64_t epochDay = dateToEpochDay(&TEST_2007_07_15);
+    for (int64_t days = -800; days <= 800; days++) {     // week day of both in month and epoch day paths
+        test = TEST_2007_07_15;
+        datePlusDays(&test, days);
+        assertDatesEquals(test, dateOfEpochDay(epochDay + days));
+        assert_int(test.weekDay, ==, dayOfWeekPlus(SUNDAY, (int32_t) days));
+    }
     return MUNIT_OK;
 }
 
@@ -563,6 +693,51 @@ static MunitResult testDateCompare(const MunitParameter params[], void *data) {
     return MUNIT_OK;
 }
 
+static MunitResult testPackDate(const MunitParameter params[], void *data) {
+    Date test = dateOf(2007, JULY, 15);
+    PackedDate packed = packDate(&test);
+    assert_uint32(packed, ==, ((2007 + PACKED_DATE_YEAR_BIAS) << 9) | (JULY << 5) | 15);
+    assertDatesEquals(unpackDate(packed), test);
+
+    Date packedRange[] = {dateOf(PACKED_DATE_MIN_YEAR, JANUARY, 1), dateOf(-1, DECEMBER, 31), dateOf(0, JANUARY, 1),
+                          dateOf(2008, FEBRUARY, 28), dateOf(2008, FEBRUARY, 29), dateOf(2008, MARCH, 1), dateOf(PACKED_DATE_MAX_YEAR, DECEMBER, 31)};
+    for (int i = 0; i < ARRAY_SIZE(packedRange); i++) {
+        assert_uint32(packDate(&packedRange[i]), !=, PACKED_DATE_INVALID);
+        assertDatesEquals(unpackDate(packDate(&packedRange[i])), packedRange[i]);
+        for (int j = 0; j < ARRAY_SIZE(packedRange); j++) {     // integer order is chronological order
+            int compare = dateCompare(&packedRange[i], &packedRange[j]);
+            PackedDate a = packDate(&packedRange[i]);
+            PackedDate b = packDate(&packedRange[j]);
+            assert_int(compare < 0, ==, a < b);
+            assert_int(compare == 0, ==, a == b);
+        }
+    }
+
+    Date date = dateOf(1999, DECEMBER, 1);
+    PackedDate previous = packDate(&date);
+    for (int i = 0; i < 800; i++) {
+        datePlusDays(&date, 1);
+        PackedDate next = packDate(&date);
+        assert_uint32(next, >, previous);
+        assertDatesEquals(unpackDate(next), date);
+        previous = next;
+    }
+
+    test = dateOf(PACKED_DATE_MAX_YEAR + 1, JANUARY, 1);    // out of packed range
+    assert_uint32(packDate(&test), ==, PACKED_DATE_INVALID);
+    test = dateOf(PACKED_DATE_MIN_YEAR - 1, DECEMBER, 31);
+    assert_uint32(packDate(&test), ==, PACKED_DATE_INVALID);
+    test = (Date) {.year = 2007, .month = FEBRUARY, .day = 30};
+    assert_uint32(packDate(&test), ==, PACKED_DATE_INVALID);
+    assert_uint32(packDate(NULL), ==, PACKED_DATE_INVALID);
+
+    test = unpackDate(PACKED_DATE_INVALID);
+    assert_false(isDateValid(&test));
+    test = unpackDate(((2007 + PACKED_DATE_YEAR_BIAS) << 9) | (FEBRUARY << 5) | 30);
+    assert_false(isDateValid(&test));
+    return MUNIT_OK;
+}
+
 static MunitResult testDateBetween(const MunitParameter params[], void *data) {
     Date expected = dateOf(2023, DECEMBER, 7);
     Date *before = dateMinusDays(&DATE_COPY(expected), 5);
@@ -703,6 +878,17 @@ static MunitResult testDateIsLeapYear(const MunitParameter params[], void *data)
     assert_false(isLeapYear(1700));
     assert_false(isLeapYear(1800));
     assert_false(isLeapYear(1900));
+
+    assert_true(isLeapYear(0));
+    assert_true(isLeapYear(-4));
+    assert_false(isLeapYear(-100));
+    assert_true(isLeapYear(-400));
+    int64_t yearRanges[][2] = {{YEAR_RANGE.min, YEAR_RANGE.min + 2000}, {-2000, 2000}, {YEAR_RANGE.max - 2000, YEAR_RANGE.max}};
+    for (int i = 0; i < ARRAY_SIZE(yearRanges); i++) {     // same as modulo rule
+        for (int64_t year = yearRanges[i][0]; year <= yearRanges[i][1]; year++) {
+            assert_int(isLeapYear(year), ==, (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)));
+        }
+    }
     return MUNIT_OK;
 }
 
@@ -778,6 +964,8 @@ static MunitTest dateTests[] = {
         {.name =  "Test dateOfEpochDay() - should correctly create date from epoch", .test = testDateOfEpochDay},
         {.name =  "Test dateOfYearDay() - should correctly create date day in year", .test = testDateOfYearDay},
         {.name =  "Test dateToEpochDay() - should correctly convert date to epoch days", .test = testDateToEpochDay},
+        {.name =  "Test dateOfEpochDay() - should convert every day of range ends same as previous algorithm", .test = testEpochDayConversion},
+        {.name =  "Test dateOfEpochDayBatch() - should convert epoch days same as dateOfEpochDay() with each kernel", .test = testDateOfEpochDayBatch},
         {.name =  "Test dateToEpochSeconds() - should correctly convert date to epoch seconds", .test = testDateToEpochSeconds},
 
         {.name =  "Test datePlusYears() - should correctly add years to date", .test = testDatePlusYears},
@@ -794,6 +982,7 @@ static MunitTest dateTests[] = {
 
         {.name =  "Test dateCompare() - should correctly compare two date instances", .test = testDateCompare},
         {.name =  "Test isDateBetween() - should correctly check that one date between other two", .test = testDateBetween},
+        {.name =  "Test packDate() - should pack date to ordered 32 bit value", .test = testPackDate},
 
         {.name =  "Test getDayOfYear() - should correctly calculate day of year", .test = testGetDayOfYear},
         {.name =  "Test getDayOfWeek() - should correctly calculate day of week", .test = testGetDayOfWeek},
@@ -579,6 +579,51 @@ static MunitResult testDateTimeCompare(const MunitParameter params[], void *data
     return MUNIT_OK;
 }
 
+static MunitResult testPackDateTime(const MunitParameter params[], void *data) {
+    DateTime test = dateTimeOfWithMillis(2007, JULY, 15, 12, 30, 40, 987);
+    PackedDateTime packed = packDateTime(&test);
+    assert_uint64(packed, !=, PACKED_DATE_TIME_INVALID);
+    assertDateTimeEquals(unpackDateTime(packed), test);
+
+    PackedDateTime previous = PACKED_DATE_TIME_INVALID;
+    for (int i = 0; i < ARRAY_SIZE(COMPARISON_DATE_TIME_ARRAY); i++) {    // whole year range, integer order is chronological order
+        DateTime dateTime = dateTimeOfWithMillis(
+                COMPARISON_DATE_TIME_ARRAY[i][0],
+                COMPARISON_DATE_TIME_ARRAY[i][1],
+                COMPARISON_DATE_TIME_ARRAY[i][2],
+                COMPARISON_DATE_TIME_ARRAY[i][3],
+                COMPARISON_DATE_TIME_ARRAY[i][4],
+                COMPARISON_DATE_TIME_ARRAY[i][5],
+                COMPARISON_DATE_TIME_ARRAY[i][6]);
+        PackedDateTime next = packDateTime(&dateTime);
+        assert_uint64(next, >, previous);
+        assertDateTimeEquals(unpackDateTime(next), dateTime);
+        previous = next;
+    }
+
+    DateTime dateTime = dateTimeOfWithMillis(2008, DECEMBER, 31, 23, 59, 58, 0);
+    previous = packDateTime(&dateTime);
+    for (int i = 0; i < 3000; i++) {    // carry of each field
+        dateTimePlusMillis(&dateTime, 1);
+        PackedDateTime next = packDateTime(&dateTime);
+        assert_uint64(next, >, previous);
+        assertDateTimeEquals(unpackDateTime(next), dateTime);
+        previous = next;
+    }
+
+    test = (DateTime) {.date = {.year = 2007, .month = FEBRUARY, .day = 30}, .time = {.hours = 12}};
+    assert_uint64(packDateTime(&test), ==, PACKED_DATE_TIME_INVALID);
+    test = (DateTime) {.date = {.year = 2007, .month = FEBRUARY, .day = 28}, .time = {.hours = 24}};
+    assert_uint64(packDateTime(&test), ==, PACKED_DATE_TIME_INVALID);
+    assert_uint64(packDateTime(NULL), ==, PACKED_DATE_TIME_INVALID);
+
+    test = unpackDateTime(PACKED_DATE_TIME_INVALID);
+    assert_false(isDateTimeValid(&test));
+    test = unpackDateTime(packed | (60ULL << 16));    // 63 minutes
+    assert_false(isDateTimeValid(&test));
+    return MUNIT_OK;
+}
+
 static MunitResult testDateTimeBetween(const MunitParameter params[], void *data) {
     DateTime expected = dateTimeOf(2023, DECEMBER, 7, 9, 0);
     DateTime *before = dateTimeMinusMinutes(&DATE_TIME_COPY(expected), 5);
@@ -635,6 +680,7 @@ static MunitTest dateTimeTests[] = {
         {.name =  "Test dateTimeToEpochSecond() - should correctly convert date-time to epoch seconds", .test = testDateTimeToEpochSecond},
         {.name =  "Test dateTimeCompare() - should correctly compare two date-time instances", .test = testDateTimeCompare},
         {.name =  "Test isDateTimeBetween() - should correctly check date-time between period", .test = testDateTimeBetween},
+        {.name =  "Test packDateTime() - should pack date-time to ordered 64 bit value", .test = testPackDateTime},
         END_OF_TESTS
 };
 
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "BaseTestTemplate.h"
+#include "GlobalDateTime.h"
+
+#define ZONE_INFO_TEST_DIRECTORY_TEMPLATE "/tmp/zoneinfoXXXXXX"
+
+static char zoneInfoTestDirectory[] = ZONE_INFO_TEST_DIRECTORY_TEMPLATE;
+
+
+static void writeBigEndian32(FILE *file, uint32_t value) {
+    uint8_t bytes[] = {value >> 24, value >> 16, value >> 8, value};
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+static void writeBigEndian64(FILE *file, int64_t value) {
+    writeBigEndian32(file, (uint32_t) ((uint64_t) value >> 32));
+    writeBigEndian32(file, (uint32_t) value);
+}
+
+static void writeTzifHeader(FILE *file, uint32_t leapCount, uint32_t timeCount, uint32_t typeCount, uint32_t charCount) {
+    uint8_t reserved[15] = {0};
+    fwrite("TZif2", 1, 5, file);
+    fwrite(reserved, 1, sizeof(reserved), file);
+    writeBigEndian32(file, 0);  // isUtCount
+    writeBigEndian32(file, 0);  // isStdCount
+    writeBigEndian32(file, leapCount);
+    writeBigEndian32(file, timeCount);
+    writeBigEndian32(file, typeCount);
+    writeBigEndian32(file, charCount);
+}
+
+static void writeTestTzifFile(const char *path, uint32_t leapCount) {  // +01:00 "TST" standard and +02:00 "TDT" summer time
+    static const int64_t transitions[] = {1648342800, 1667091600, 1679792400};
+    static const uint8_t typeIndexes[] = {1, 0, 1};
+    static const char abbreviations[] = "TST\0TDT";
+
+    FILE *file = fopen(path, "wb");
+    writeTzifHeader(file, 0, 0, 1, 4);     // minimal version 1 block
+    writeBigEndian32(file, 3600);
+    fputc(0, file);
+    fputc(0, file);
+    fwrite(abbreviations, 1, 4, file);
+
+    writeTzifHeader(file, leapCount, 3, 2, sizeof(abbreviations));
+    for (uint32_t i = 0; i < ARRAY_SIZE(transitions); i++) {
+        writeBigEndian64(file, transitions[i]);
+    }
+    fwrite(typeIndexes, 1, sizeof(typeIndexes), file);
+    writeBigEndian32(file, 3600);
+    fputc(0, file);
+    fputc(0, file);
+    writeBigEndian32(file, 7200);
+    fputc(1, file);
+    fputc(4, file);
+    fwrite(abbreviations, 1, sizeof(abbreviations), file);
+    for (uint32_t i = 0; i < leapCount; i++) {     // leap second occurrence and correction, such as "right/" zones
+        writeBigEndian64(file, 78796800 + i * 15778800LL);
+        writeBigEndian32(file, i + 1);
+    }
+    fputs("\nTST-1TDT,M3.5.0,M10.5.0/3\n", file);
+    fclose(file);
+}
+
+static void *setupZoneInfoDirectory(const MunitParameter params[], void *userData) {
+    strcpy(zoneInfoTestDirectory, ZONE_INFO_TEST_DIRECTORY_TEMPLATE);
+    mkdtemp(zoneInfoTestDirectory);
+    char path[ZONE_INFO_PATH_MAX_LENGTH];
+    snprintf(path, sizeof(path), "%s/Test", zoneInfoTestDirectory);
+    mkdir(path, 0700);
+    snprintf(path, sizeof(path), "%s/Test/Zone", zoneInfoTestDirectory);
+    writeTestTzifFile(path, 0);
+    snprintf(path, sizeof(path), "%s/Test/Leap", zoneInfoTestDirectory);
+    writeTestTzifFile(path, 2);
+    snprintf(path, sizeof(path), "%s/Test/Broken", zoneInfoTestDirectory);
+    FILE *file = fopen(path, "wb");
+    fputs("TZif2 is not enough", file);
+    fclose(file);
+    setZoneInfoDirectory(zoneInfoTestDirectory);
+    return NULL;
+}
+
+static void tearDownZoneInfoDirectory(void *fixture) {
+    char path[ZONE_INFO_PATH_MAX_LENGTH];
+    snprintf(path, sizeof(path), "%s/Test/Zone", zoneInfoTestDirectory);
+    remove(path);
+    snprintf(path, sizeof(path), "%s/Test/Leap", zoneInfoTestDirectory);
+    remove(path);
+    snprintf(path, sizeof(path), "%s/Test/Broken", zoneInfoTestDirectory);
+    remove(path);
+    snprintf(path, sizeof(path), "%s/Test", zoneInfoTestDirectory);
+    rmdir(path);
+    rmdir(zoneInfoTestDirectory);
+    freeLoadedTimeZones();
+    setZoneInfoDirectory(NULL);
+}
+
+static MunitResult testLoadTimeZone(const MunitParameter params[], void *data) {
+    const TimeZone *zone = loadTimeZone("Test/Zone");
+    assert_not_null(zone);
+    assert_string_equal(zone->id, "Test/Zone");
+    assert_int32(zone->utcOffset, ==, 7200);
+    assert_uint16(zone->ruleCount, ==, 3);
+    assert_int64(zone->rules[0].transition, ==, 1648342800);
+    assert_int32(zone->rules[0].gmtOffset, ==, 7200);
+    assert_true(zone->rules[0].isDaylightTime);
+    assert_int32(zone->rules[1].gmtOffset, ==, 3600);
+    assert_false(zone->rules[1].isDaylightTime);
+    assert_string_equal(zone->names[ZONE_SHORT_NAME_STD_INDEX], "TST");
+    assert_string_equal(zone->names[ZONE_SHORT_NAME_DTS_INDEX], "TDT");
+    assert_ptr_equal(loadTimeZone("Test/Zone"), zone);  // cached after first load
+
+    DateTime dt = dateTimeOf(2022, 7, 1, 12, 0);
+    int64_t epoch = dateTimeToEpochSecond(&dt, 0);
+    assert_int32(resolveTimeZoneOffset(epoch, zone), ==, 7200);
+    assert_string_equal(resolveTimeZoneName(epoch, zone, ZONE_NAME_SHORT), "TDT");
+    dt = dateTimeOf(2022, 12, 1, 12, 0);
+    epoch = dateTimeToEpochSecond(&dt, 0);
+    assert_int32(resolveTimeZoneOffset(epoch, zone), ==, 3600);
+    assert_string_equal(resolveTimeZoneName(epoch, zone, ZONE_NAME_SHORT), "TST");
+    assert_not_null(zone->recurringRule);     // footer rule after the last transition
+    dt = dateTimeOf(2030, 7, 1, 12, 0);
+    epoch = dateTimeToEpochSecond(&dt, 0);
+    assert_int32(resolveTimeZoneOffset(epoch, zone), ==, 7200);
+    assert_string_equal(resolveTimeZoneName(epoch, zone, ZONE_NAME_SHORT), "TDT");
+
+    assert_null(loadTimeZone("Test/Broken"));
+    assert_null(loadTimeZone("Test/Leap"));     // transitions count leap seconds
+    assert_null(loadTimeZone("Test/Missing"));
+    assert_null(loadTimeZone("../etc/passwd"));
+    assert_null(loadTimeZone("/etc/passwd"));
+    assert_null(loadTimeZone(""));
+    assert_null(loadTimeZone(NULL));
+    return MUNIT_OK;
+}
+
+static MunitResult testLoadSystemTimeZone(const MunitParameter params[], void *data) {
+    setZoneInfoDirectory(NULL);
+    const TimeZone *loadedZone = loadTimeZone("Europe/Paris");
+    setZoneInfoDirectory(zoneInfoTestDirectory);
+    if (loadedZone == NULL) return MUNIT_SKIP;  // no system zone info
+
+    const TimeZone *compiledZone = findTimeZone("Europe/Paris");
+    assert_ptr_equal(loadedZone->names, compiledZone->names);
+    for (uint32_t i = 0; i < compiledZone->ruleCount; i++) {
+        int64_t transition = compiledZone->rules[i].transition;
+        if (transition < 1000000000 || transition > 1700000000) continue;   // compare well known period only
+        for (int64_t epoch = transition - 7200; epoch <= transition + 7200; epoch += 1800) {
+            assert_int32(resolveTimeZoneOffset(epoch, loadedZone), ==, resolveTimeZoneOffset(epoch, compiledZone));
+        }
+    }
+    return MUNIT_OK;
+}
+
+static bool isSystemTzdataVersion(const char *version) {   // "# version 2025b" first line of tzdata.zi
+    FILE *file = fopen(ZONE_INFO_DEFAULT_DIRECTORY "/tzdata.zi", "r");
+    if (file == NULL) return false;
+    char line[64];
+    char systemVersion[16];
+    bool isSame = fgets(line, sizeof(line), file) != NULL &&
+                  sscanf(line, "# version %15s", systemVersion) == 1 &&
+                  strcmp(systemVersion, version) == 0;
+    fclose(file);
+    return isSame;
+}
+
+static bool isSameZoneOffset(int64_t transition, const TimeZone *loadedZone, const TimeZone *compiledZone) {
+    int64_t fromEpoch = compiledZone->ruleCount > 0 ? compiledZone->rules[0].transition : 0;   // generated rules start
+    for (int64_t epoch = transition - 1; epoch <= transition; epoch++) {
+        if (epoch < fromEpoch) continue;
+        int32_t loadedOffset = resolveTimeZoneOffset(epoch, loadedZone);
+        int32_t compiledOffset = resolveTimeZoneOffset(epoch, compiledZone);
+        if (loadedOffset != compiledOffset) {
+            munit_errorf("%s: compiled offset %d differs from TZif offset %d at %lld",
+                         compiledZone->id, compiledOffset, loadedOffset, (long long) epoch);
+            return false;
+        }
+    }
+    return true;
+}
+
+static MunitResult testGeneratedZonesMatchSystemTzif(const MunitParameter params[], void *data) {
+    if (!isSystemTzdataVersion(TIME_ZONE_DATA_VERSION)) return MUNIT_SKIP;  // generated from other tzdata
+    DateTime dt = dateTimeOf(2100, 1, 1, 0, 0);
+    int64_t toEpoch = dateTimeToEpochSecond(&dt, 0);
+
+    setZoneInfoDirectory(NULL);
+    for (uint16_t i = 0; i < getTimeZoneCount(); i++) {
+        const TimeZone *compiledZone = getTimeZoneByIndex(i);
+        const TimeZone *loadedZone = loadTimeZone(compiledZone->id);
+        assert_not_null(loadedZone);
+
+        for (uint32_t j = 0; j < compiledZone->ruleCount; j++) {
+            assert_true(isSameZoneOffset(compiledZone->rules[j].transition, loadedZone, compiledZone));
+        }
+        for (uint32_t j = 0; j < loadedZone->ruleCount; j++) {
+            int64_t transition = loadedZone->rules[j].transition;
+            if (transition <= 0 || transition >= toEpoch) continue;    // generated from 1970
+            assert_true(isSameZoneOffset(transition, loadedZone, compiledZone));
+        }
+
+        TimeZoneRule decodedRules[2];   // recurring rule transitions after the last compiled rule
+        int64_t epoch = compiledZone->ruleCount > 0 ? compiledZone->rules[compiledZone->ruleCount - 1].transition : 0;
+        for (;;) {
+            ZoneTransition transition = findRecurringRuleTransition(epoch + 1, compiledZone, decodedRules);
+            if (transition.after == NULL || transition.after->transition >= toEpoch) break;
+            epoch = transition.after->transition;
+            assert_true(isSameZoneOffset(epoch, loadedZone, compiledZone));
+        }
+    }
+    setZoneInfoDirectory(zoneInfoTestDirectory);
+    return MUNIT_OK;
+}
+
+static MunitResult testZoneDatabaseReload(const MunitParameter params[], void *data) {
+    const char *const zoneIds[] = {"Test/Zone", "Test/Missing", "Test/Broken"};
+    assert_null(loadZoneDatabase(NULL, zoneIds + 1, 2));
+    ZoneDatabase *database = loadZoneDatabase(NULL, zoneIds, ARRAY_SIZE(zoneIds));
+    assert_not_null(database);
+    assert_uint16(database->zoneCount, ==, 1);
+
+    int32_t reader = registerZoneDatabaseReader();
+    assert_int32(reader, !=, ZONE_DATABASE_NO_READER);
+    assert_null(enterZoneDatabase(reader));     // nothing published yet
+    leaveZoneDatabase(reader);
+
+    uint32_t version = publishZoneDatabase(database);
+    const ZoneDatabase *current = enterZoneDatabase(reader);
+    assert_ptr_equal(current, database);
+    assert_uint32(current->version, ==, version);
+    const TimeZone *zone = findDatabaseTimeZone(current, "Test/Zone");
+    assert_not_null(zone);
+    assert_null(findDatabaseTimeZone(current, "Test/Missing"));
+    DateTime dt = dateTimeOf(2022, 7, 1, 12, 0);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), zone), ==, 7200);
+
+    ZoneDatabase *reloaded = loadZoneDatabase(NULL, zoneIds, 1);
+    assert_uint32(publishZoneDatabase(reloaded), ==, version + 1);
+    assert_uint16(reclaimZoneDatabases(), ==, 1);   // reader still uses previous database
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), zone), ==, 7200);
+    leaveZoneDatabase(reader);
+    assert_uint16(reclaimZoneDatabases(), ==, 0);
+
+    assert_ptr_equal(enterZoneDatabase(reader), reloaded);  // new section sees new database
+    leaveZoneDatabase(reader);
+    assert_uint32(publishZoneDatabase(NULL), ==, 0);
+    assert_uint16(reclaimZoneDatabases(), ==, 0);
+    assert_null(enterZoneDatabase(reader));
+    leaveZoneDatabase(reader);
+    unregisterZoneDatabaseReader(reader);
+
+    int32_t registered[ZONE_DATABASE_MAX_READERS];
+    for (int32_t i = 0; i < ZONE_DATABASE_MAX_READERS; i++) {
+        registered[i] = registerZoneDatabaseReader();
+        assert_int32(registered[i], !=, ZONE_DATABASE_NO_READER);
+    }
+    assert_int32(registerZoneDatabaseReader(), ==, ZONE_DATABASE_NO_READER);
+    for (int32_t i = 0; i < ZONE_DATABASE_MAX_READERS; i++) {
+        unregisterZoneDatabaseReader(registered[i]);
+    }
+    return MUNIT_OK;
+}
+
+static MunitTest timeZoneLoaderTests[] = {
+        {.name =  "Test loadTimeZone() - should load and cache zone from TZif file", .test = testLoadTimeZone, .setup = setupZoneInfoDirectory, .tear_down = tearDownZoneInfoDirectory},
+        {.name =  "Test loadTimeZone() - should resolve same offsets as compiled zone", .test = testLoadSystemTimeZone, .setup = setupZoneInfoDirectory, .tear_down = tearDownZoneInfoDirectory},
+        {.name =  "Test loadTimeZone() - should resolve same offsets as all generated zones", .test = testGeneratedZonesMatchSystemTzif, .setup = setupZoneInfoDirectory, .tear_down = tearDownZoneInfoDirectory},
+        {.name =  "Test publishZoneDatabase() - should release replaced database after readers leave it", .test = testZoneDatabaseReload, .setup = setupZoneInfoDirectory, .tear_down = tearDownZoneInfoDirectory},
+        END_OF_TESTS
+};
+
+static const MunitSuite timeZoneLoaderTestSuite = {
+        .prefix = "TimeZoneLoader: ",
+        .tests = timeZoneLoaderTests,
+        .suites = NULL,
+        .iterations = 1,
+        .options = MUNIT_SUITE_OPTION_NONE
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "BaseTestTemplate.h"
+#include "GlobalDateTime.h"
+
+
+static MunitResult testResolveTableTimeZoneOffset(const MunitParameter params[], void *data) {
+    const TimeZone *zones[] = {findTimeZone("Europe/Paris"), findTimeZone("Australia/Lord_Howe"), findTimeZone("Africa/Casablanca"),
+                               findTimeZone("America/St_Johns"), findTimeZone("Asia/Kolkata"), &UTC};
+    DateTime dt = dateTimeOf(2010, 1, 1, 0, 0);
+    int64_t startEpoch = dateTimeToEpochSecond(&dt, 0);
+    dt = dateTimeOf(2040, 1, 1, 0, 0);
+    int64_t endEpoch = dateTimeToEpochSecond(&dt, 0);
+
+    for (uint32_t z = 0; z < ARRAY_SIZE(zones); z++) {
+        ZoneOffsetTable table;
+        assert_true(initZoneOffsetTable(&table, zones[z], 2015, 2035));
+        assert_not_null(table.buckets);
+        for (int64_t epoch = startEpoch; epoch < endEpoch; epoch += 3 * SECONDS_PER_HOUR + 7) {   // inside and outside window
+            assert_int32(resolveTableTimeZoneOffset(epoch, &table), ==, resolveTimeZoneOffset(epoch, zones[z]));
+        }
+        for (uint32_t i = 0; i < zones[z]->ruleCount; i++) {    // around each transition, including gap of the previous rule
+            int64_t transition = zones[z]->rules[i].transition;
+            for (int64_t epoch = transition - 7200; epoch <= transition + 7200; epoch += 60) {
+                assert_int32(resolveTableTimeZoneOffset(epoch, &table), ==, resolveTimeZoneOffset(epoch, zones[z]));
+                assert_int32(resolveTableTimeZoneOffset(epoch + 1, &table), ==, resolveTimeZoneOffset(epoch + 1, zones[z]));
+            }
+        }
+        freeZoneOffsetTable(&table);
+        assert_null(table.buckets);
+    }
+
+    const TimeZoneRule berlinRules[] = {
+            {.gmtOffset = 3600, .isDaylightTime = false, .transition = -670460400},   // 1948-10-03
+            {.gmtOffset = 7200, .isDaylightTime = true, .transition = -654130800},    // 1949-04-10
+            {.gmtOffset = 3600, .isDaylightTime = false, .transition = -639010800},   // 1949-10-02
+            {0},
+    };
+    TimeZone berlin = {.id = "Europe/Berlin", .utcOffset = 3600, .names = CET_ZONE_NAMES, .rules = berlinRules};
+    ZoneOffsetTable table;
+    assert_true(initZoneOffsetTable(&table, &berlin, 1948, 1949));   // transitions before 1970
+    for (uint32_t i = 0; i < ARRAY_SIZE(berlinRules) - 1; i++) {
+        int64_t transition = berlinRules[i].transition;
+        for (int64_t epoch = transition - 7200; epoch <= transition + 7200; epoch += 60) {
+            assert_int32(resolveTableTimeZoneOffset(epoch, &table), ==, resolveTimeZoneOffset(epoch, &berlin));
+            assert_int32(resolveTableTimeZoneOffset(epoch + 1, &table), ==, resolveTimeZoneOffset(epoch + 1, &berlin));
+        }
+    }
+    freeZoneOffsetTable(&table);
+
+    assert_true(initZoneOffsetTable(&table, &UTC, 2022, 2022));
+    assert_uint32(table.bucketCount, ==, (365 * SECONDS_PER_DAY + 1023) / 1024);
+    assert_uint8(table.offsetCount, ==, 1);
+    freeZoneOffsetTable(&table);
+    assert_false(initZoneOffsetTable(&table, &UTC, 2035, 2015));
+    assert_false(initZoneOffsetTable(NULL, &UTC, 2015, 2035));
+    return MUNIT_OK;
+}
+
+static MunitTest timeZoneOffsetTableTests[] = {
+        {.name =  "Test resolveTableTimeZoneOffset() - should resolve same offset as rules search", .test = testResolveTableTimeZoneOffset},
+        END_OF_TESTS
+};
+
+static const MunitSuite timeZoneOffsetTableTestSuite = {
+        .prefix = "TimeZoneOffsetTable: ",
+        .tests = timeZoneOffsetTableTests,
+        .suites = NULL,
+        .iterations = 1,
+        .options = MUNIT_SUITE_OPTION_NONE
+};
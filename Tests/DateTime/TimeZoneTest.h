@@ -20,6 +20,134 @@ static MunitResult testZoneOf(const MunitParameter params[], void *data) {
     return MUNIT_OK;
 }
 
+static MunitResult testFindTimeZoneWithLength(const MunitParameter params[], void *data) {
+    for (uint16_t i = 0; i < getTimeZoneCount(); i++) {     // perfect hash resolves every zone
+        const TimeZone *zone = getTimeZoneByIndex(i);
+        assert_ptr_equal(findTimeZone(zone->id), zone);
+    }
+
+    const char *text = "[Europe/Paris]";
+    const TimeZone *zone = findTimeZoneWithLength(text + 1, 12);
+    assert_not_null(zone);
+    assert_string_equal(zone->id, "Europe/Paris");
+    assert_null(findTimeZoneWithLength(text + 1, 11));
+    assert_null(findTimeZoneWithLength(text, 13));
+    assert_null(findTimeZoneWithLength(text, 0));
+    assert_null(findTimeZone("Mars/Olympus_Mons"));
+    assert_null(findTimeZone("europe/paris"));
+    return MUNIT_OK;
+}
+
+static MunitResult testFindZoneNameCandidates(const MunitParameter params[], void *data) {
+    const ZoneNameCandidate *candidates = NULL;
+    uint8_t count = findZoneNameCandidates("CST", 3, &candidates);
+    assert_uint8(count, >=, 2);
+    assert_string_equal(candidates[0].zoneId, "America/Chicago");
+    assert_int32(candidates[0].offset, ==, -21600);
+    assert_false(candidates[0].isDaylightTime);
+    assert_uint8(candidates[0].candidateCount, ==, count);
+    bool hasChinaTime = false;
+    for (uint8_t i = 0; i < count; i++) {
+        assert_string_equal(candidates[i].name, "CST");
+        hasChinaTime |= strcmp(candidates[i].zoneId, "Asia/Shanghai") == 0 && candidates[i].offset == 28800;
+    }
+    assert_true(hasChinaTime);
+
+    const char *text = "CEST 2021";
+    assert_uint8(findZoneNameCandidates(text, 4, &candidates), >=, 1);
+    assert_string_equal(candidates[0].zoneId, "Europe/Paris");
+    assert_int32(candidates[0].offset, ==, 7200);
+    assert_true(candidates[0].isDaylightTime);
+
+    assert_uint8(findZoneNameCandidates("Pacific Standard Time", 21, &candidates), >=, 1);
+    assert_string_equal(candidates[0].zoneId, "America/Los_Angeles");
+    assert_int32(candidates[0].offset, ==, -28800);
+
+    assert_uint8(findZoneNameCandidates("CES", 3, &candidates), ==, 0);
+    assert_uint8(findZoneNameCandidates("XYZT", 4, &candidates), ==, 0);
+    assert_uint8(findZoneNameCandidates(NULL, 3, &candidates), ==, 0);
+
+    for (uint16_t i = 0; i < getTimeZoneCount(); i++) {     // every short zone name is indexed
+        const char *name = getTimeZoneByIndex(i)->names[ZONE_SHORT_NAME_STD_INDEX];
+        if (name[0] == '+' || name[0] == '-') continue;
+        count = findZoneNameCandidates(name, strlen(name), &candidates);
+        assert_uint8(count, >=, 1);
+        for (uint8_t j = 0; j < count; j++) {
+            assert_string_equal(candidates[j].name, name);
+            assert_not_null(findTimeZone(candidates[j].zoneId));
+        }
+    }
+    return MUNIT_OK;
+}
+
+static MunitResult testTimeZoneLinks(const MunitParameter params[], void *data) {
+    const TimeZone *alias = findTimeZone("America/Atka");
+    const TimeZone *canonical = findTimeZone("America/Adak");
+    assert_string_equal(alias->id, "America/Atka");
+    assert_ptr_equal(getCanonicalTimeZone(alias), canonical);
+    assert_ptr_equal(getCanonicalTimeZone(canonical), canonical);
+    assert_ptr_equal(alias->rules, canonical->rules);   // alias shares rules of link target
+    DateTime dt = dateTimeOf(2022, 12, 1, 12, 0);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), alias), ==, -36000);
+
+    assert_true(isTimeZoneEquals(alias, canonical));
+    assert_true(isTimeZoneEquals(findTimeZone("Australia/North"), findTimeZone("Australia/Darwin")));
+    assert_false(isTimeZoneEquals(findTimeZone("Europe/Paris"), findTimeZone("Europe/Berlin")));
+    TimeZone paris = {.id = "Europe/Paris", .utcOffset = 7200};
+    assert_true(isTimeZoneEquals(&paris, findTimeZone("Europe/Paris")));
+    TimeZone customZone = {.id = "Custom_Zone", .utcOffset = 28800};
+    TimeZone otherCustomZone = {.id = "Custom_Zone", .utcOffset = 28800};
+    assert_true(isTimeZoneEquals(&customZone, &otherCustomZone));
+    otherCustomZone.utcOffset = 3600;
+    assert_false(isTimeZoneEquals(&customZone, &otherCustomZone));
+    assert_ptr_equal(getCanonicalTimeZone(&customZone), &customZone);
+
+    for (uint16_t i = 0; i < getTimeZoneCount(); i++) {
+        const TimeZone *zone = getTimeZoneByIndex(i);
+        const TimeZone *linkTarget = getTimeZoneByIndex(ZONE_LINK_INDEXES[i]);
+        assert_uint16(ZONE_LINK_INDEXES[ZONE_LINK_INDEXES[i]], ==, ZONE_LINK_INDEXES[i]);   // no link chains
+        assert_ptr_equal(zone->rules, linkTarget->rules);
+        assert_ptr_equal(zone->names, linkTarget->names);
+    }
+    return MUNIT_OK;
+}
+
+static MunitResult testZoneHandles(const MunitParameter params[], void *data) {
+    const TimeZone *paris = findTimeZone("Europe/Paris");
+    ZoneHandle parisHandle = zoneHandleOf(paris);
+    assert_uint16(parisHandle, <, getTimeZoneCount());
+    assert_ptr_equal(resolveZoneHandle(parisHandle, NULL, 0, NULL), paris);
+    TimeZone parisCopy = *paris;
+    assert_uint16(zoneHandleOf(&parisCopy), ==, parisHandle);     // copy resolves to the same index
+
+    assert_true(isZoneHandleEquals(zoneHandleOf(findTimeZone("America/Atka")), NULL, zoneHandleOf(findTimeZone("America/Adak")), NULL));
+    assert_false(isZoneHandleEquals(parisHandle, NULL, zoneHandleOf(findTimeZone("Europe/Berlin")), NULL));
+
+    TimeZone fixedZone;
+    TimeZone offsetZone = {.id = "UTC", .utcOffset = 7200, .names = UTC_ZONE_NAMES};
+    assert_uint16(zoneHandleOf(&offsetZone), ==, ZONE_HANDLE_FIXED_UTC);
+    assert_uint16(zoneHandleOf(&GMT), ==, ZONE_HANDLE_FIXED_GMT);
+    const TimeZone *resolvedZone = resolveZoneHandle(ZONE_HANDLE_FIXED_UTC, NULL, 7200, &fixedZone);
+    assert_ptr_equal(resolvedZone, &fixedZone);
+    assert_string_equal(resolvedZone->id, "UTC");
+    assert_int32(resolvedZone->utcOffset, ==, 7200);
+    assert_false(isZoneHandleEquals(ZONE_HANDLE_FIXED_UTC, NULL, ZONE_HANDLE_FIXED_GMT, NULL));
+
+    static const TimeZone customZone = {.id = "Custom_Zone", .utcOffset = 28800};
+    static const TimeZone otherCustomZone = {.id = "Custom_Zone", .utcOffset = 28800};
+    static const TimeZone differentCustomZone = {.id = "Other_Zone", .utcOffset = 28800};
+    ZoneHandle customHandle = zoneHandleOf(&customZone);
+    assert_uint16(customHandle, ==, ZONE_HANDLE_EXTERNAL);
+    assert_ptr_equal(resolveZoneHandle(customHandle, &customZone, 0, NULL), &customZone);
+    assert_true(isZoneHandleEquals(customHandle, &customZone, zoneHandleOf(&otherCustomZone), &otherCustomZone));     // compared as zones
+    assert_false(isZoneHandleEquals(customHandle, &customZone, zoneHandleOf(&differentCustomZone), &differentCustomZone));
+    assert_false(isZoneHandleEquals(customHandle, &customZone, parisHandle, NULL));
+
+    assert_uint16(zoneHandleOf(NULL), ==, ZONE_HANDLE_NONE);
+    assert_null(resolveZoneHandle(ZONE_HANDLE_NONE, NULL, 0, &fixedZone));
+    return MUNIT_OK;
+}
+
 static MunitResult testResolveTimeZoneOffset(const MunitParameter params[], void *data) {
     DateTime dt = dateTimeOf(2008, 4, 12, 7, 23);
     int64_t epoch = dateTimeToEpochSecond(&dt, 0);
@@ -28,10 +156,51 @@ static MunitResult testResolveTimeZoneOffset(const MunitParameter params[], void
     int32_t result = resolveTimeZoneOffset(epoch, zone);
     assert_int32(result, ==, 7200);
 
-    dt = dateTimeOf(2022, 3, 27, 1, 30);    // day light saving gap to +1 hour
+    dt = dateTimeOf(2022, 3, 27, 0, 59);    // day light saving gap to +1 hour at 01:00 UTC
     epoch = dateTimeToEpochSecond(&dt, 0);
     result = resolveTimeZoneOffset(epoch, zone);
     assert_int32(result, ==, 3600);
+    dt = dateTimeOf(2022, 3, 27, 1, 30);
+    epoch = dateTimeToEpochSecond(&dt, 0);
+    result = resolveTimeZoneOffset(epoch, zone);
+    assert_int32(result, ==, 7200);
+    return MUNIT_OK;
+}
+
+static MunitResult testResolveTimeZoneOffsetBefore1970(const MunitParameter params[], void *data) {
+    const TimeZoneRule newYorkRules[] = {
+            {.gmtOffset = -18000, .isDaylightTime = false, .transition = -321472800},  // 1959-10-25
+            {.gmtOffset = -14400, .isDaylightTime = true, .transition = -305744400},   // 1960-04-24
+            {.gmtOffset = -18000, .isDaylightTime = false, .transition = -289418400},  // 1960-10-30
+            {0},
+    };
+    TimeZone newYork = {.id = "America/New_York", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = newYorkRules};
+    DateTime dt = dateTimeOf(1960, 4, 24, 7, 30);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), &newYork), ==, -14400);
+    dt = dateTimeOf(1960, 7, 1, 12, 0);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), &newYork), ==, -14400);
+    dt = dateTimeOf(1960, 1, 1, 12, 0);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), &newYork), ==, -18000);
+
+    const TimeZoneRule berlinRules[] = {
+            {.gmtOffset = 3600, .isDaylightTime = false, .transition = -670460400},   // 1948-10-03
+            {.gmtOffset = 7200, .isDaylightTime = true, .transition = -654130800},    // 1949-04-10
+            {.gmtOffset = 3600, .isDaylightTime = false, .transition = -639010800},   // 1949-10-02
+            {0},
+    };
+    TimeZone berlin = {.id = "Europe/Berlin", .utcOffset = 3600, .names = CET_ZONE_NAMES, .rules = berlinRules};
+    dt = dateTimeOf(1949, 4, 10, 0, 59);    // day light saving gap to +1 hour at 01:00 UTC, same as after 1970
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), &berlin), ==, 3600);
+    dt = dateTimeOf(1949, 4, 10, 1, 30);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), &berlin), ==, 7200);
+    dt = dateTimeOf(1949, 7, 1, 12, 0);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), &berlin), ==, 7200);
+
+    ZoneTransition transition = {.before = &berlinRules[1], .after = &berlinRules[2]};
+    assert_true(isTransitionGap(&transition, berlinRules[1].transition));
+    assert_true(isTransitionGap(&transition, berlinRules[1].transition + 3599));
+    assert_false(isTransitionGap(&transition, berlinRules[1].transition + 3600));
+    assert_false(isTransitionGap(&transition, berlinRules[1].transition - 1));
     return MUNIT_OK;
 }
 
@@ -61,9 +230,552 @@ static MunitResult testResolveTimeZoneName(const MunitParameter params[], void *
     return MUNIT_OK;
 }
 
+static ZoneTransition findZoneRuleTransitionLinear(int64_t epochSeconds, const TimeZone *zone) {
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    for (uint32_t i = 1; zone->rules != NULL && zone->rules[i - 1].transition != 0 && zone->rules[i].transition != 0; i++) {
+        if (zone->rules[i].transition >= epochSeconds) {
+            zoneTransition.before = &zone->rules[i - 1];
+            zoneTransition.after = &zone->rules[i];
+            break;
+        }
+    }
+    return zoneTransition;
+}
+
+static MunitResult testFindZoneRuleTransition(const MunitParameter params[], void *data) {
+    const TimeZone *zone = findTimeZone("America/New_York");
+    assert_not_null(zone);
+    assert_int64(zone->rules[zone->ruleCount].transition, ==, 0);   // stored count ends at terminating entry
+
+    TimeZone userZone = {.id = "America/New_York", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NEW_YORK_RULES};
+    for (uint32_t i = 0; i < zone->ruleCount; i++) {
+        int64_t transition = zone->rules[i].transition;
+        int64_t epochs[] = {transition - 1, transition, transition + 1};
+        for (uint32_t j = 0; j < ARRAY_SIZE(epochs); j++) {
+            ZoneTransition expected = findZoneRuleTransitionLinear(epochs[j], zone);
+            ZoneTransition result = findZoneRuleTransition(epochs[j], zone);
+            assert_ptr_equal(result.before, expected.before);
+            assert_ptr_equal(result.after, expected.after);
+
+            result = findZoneRuleTransition(epochs[j], &userZone);  // without stored rule count
+            if (expected.before == NULL) {
+                assert_null(result.before);
+                continue;
+            }
+            assert_int64(result.before->transition, ==, expected.before->transition);
+            assert_int64(result.after->transition, ==, expected.after->transition);
+        }
+    }
+
+    ZoneTransition result = findZoneRuleTransition(zone->rules[zone->ruleCount - 1].transition + 1, zone);
+    assert_null(result.before);
+    assert_null(result.after);
+    result = findZoneRuleTransition(1000, &UTC);
+    assert_null(result.before);
+    assert_null(result.after);
+    return MUNIT_OK;
+}
+
+static MunitResult testFindIndexedZoneRuleTransition(const MunitParameter params[], void *data) {
+    const TimeZone *newYork = findTimeZone("America/New_York");
+    TimeZone userZone = {.id = "America/New_York", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NEW_YORK_RULES};
+    const TimeZone *zones[] = {newYork, &userZone, findTimeZone("Europe/Paris"), findTimeZone("Asia/Tokyo"), &UTC};
+    static ZoneTransitionBlock blocks[ZONE_TRANSITION_BLOCK_COUNT(UINT16_MAX)];   // any generated zone rule count
+    ZoneTransitionIndex index;
+
+    ZoneSearchKernel detectedKernel = detectZoneSearchKernel();
+    for (uint32_t z = 0; z < ARRAY_SIZE(zones); z++) {
+        assert_true(buildZoneTransitionIndex(zones[z], blocks, ARRAY_SIZE(blocks), &index));
+        assert_int(index.kernel, ==, detectedKernel);
+        for (int kernel = ZONE_SEARCH_SCALAR; kernel <= (int) detectedKernel; kernel++) {
+            index.kernel = (ZoneSearchKernel) kernel;
+            for (uint32_t i = 0; i < index.ruleCount; i++) {
+                int64_t transition = index.rules[i].transition;
+                int64_t epochs[] = {transition - 1, transition, transition + 1};
+                for (uint32_t j = 0; j < ARRAY_SIZE(epochs); j++) {
+                    ZoneTransition expected = findZoneRuleTransition(epochs[j], zones[z]);
+                    ZoneTransition result = findIndexedZoneRuleTransition(epochs[j], &index);
+                    assert_ptr_equal(result.before, expected.before);
+                    assert_ptr_equal(result.after, expected.after);
+                    assert_int32(resolveIndexedTimeZoneOffset(epochs[j], &index, zones[z]), ==, resolveTimeZoneOffset(epochs[j], zones[z]));
+                }
+            }
+            int64_t bounds[] = {INT64_MIN, INT64_MAX};
+            for (uint32_t j = 0; j < ARRAY_SIZE(bounds); j++) {
+                ZoneTransition expected = findZoneRuleTransition(bounds[j], zones[z]);
+                ZoneTransition result = findIndexedZoneRuleTransition(bounds[j], &index);
+                assert_ptr_equal(result.before, expected.before);
+                assert_ptr_equal(result.after, expected.after);
+            }
+        }
+    }
+
+    assert_false(buildZoneTransitionIndex(newYork, blocks, ZONE_TRANSITION_BLOCK_COUNT(newYork->ruleCount) - 1, &index));
+    ZoneTransition result = findIndexedZoneRuleTransition(0, NULL);
+    assert_null(result.before);
+    return MUNIT_OK;
+}
+
+static MunitResult testResolveTimeZoneOffsetCached(const MunitParameter params[], void *data) {
+    const TimeZone *paris = findTimeZone("Europe/Paris");
+    const TimeZone *newYork = findTimeZone("America/New_York");
+    ZoneTransitionCache cache = {0};
+
+    DateTime dt = dateTimeOf(2000, 1, 1, 0, 0);
+    int64_t startEpoch = dateTimeToEpochSecond(&dt, 0);
+    uint32_t lookupCount = 0;
+    for (int64_t epoch = startEpoch; epoch < startEpoch + (10LL * 366 * SECONDS_PER_DAY); epoch += 1800) {
+        assert_int32(resolveTimeZoneOffsetCached(&cache, epoch, paris), ==, resolveTimeZoneOffset(epoch, paris));
+        lookupCount++;
+    }
+    assert_uint64(cache.hits + cache.misses, ==, lookupCount);
+    assert_uint64(cache.misses, <=, 25);    // two transitions per year
+
+    uint64_t misses = cache.misses;
+    assert_int32(resolveTimeZoneOffsetCached(&cache, startEpoch, newYork), ==, resolveTimeZoneOffset(startEpoch, newYork));
+    assert_uint64(cache.misses, ==, misses + 1);    // other zone rules
+
+    cache = (ZoneTransitionCache) {0};  // recurring rule windows after the last zone rule
+    dt = dateTimeOf(2100, 1, 1, 0, 0);
+    startEpoch = dateTimeToEpochSecond(&dt, 0);
+    for (int64_t epoch = startEpoch; epoch < startEpoch + (10LL * 366 * SECONDS_PER_DAY); epoch += 1800) {
+        assert_int32(resolveTimeZoneOffsetCached(&cache, epoch, paris), ==, resolveTimeZoneOffset(epoch, paris));
+    }
+    assert_uint64(cache.misses, <=, 25);
+    assert_int32(resolveTimeZoneOffsetCached(&cache, startEpoch, &UTC), ==, 0);
+    assert_int32(resolveTimeZoneOffsetCached(NULL, startEpoch, paris), ==, resolveTimeZoneOffset(startEpoch, paris));
+    return MUNIT_OK;
+}
+
+static MunitResult testResolveTimeZoneOffsetYearCached(const MunitParameter params[], void *data) {
+    const TimeZone *zones[] = {findTimeZone("Europe/Paris"), findTimeZone("Australia/Sydney"), findTimeZone("Africa/Casablanca"),
+                               findTimeZone("America/Sao_Paulo"), findTimeZone("Asia/Tokyo"), &UTC};
+    ZoneYearCache cache = {0};
+    DateTime dt = dateTimeOf(1960, 1, 1, 0, 0);
+    int64_t startEpoch = dateTimeToEpochSecond(&dt, 0);
+    dt = dateTimeOf(2100, 1, 1, 0, 0);
+    int64_t endEpoch = dateTimeToEpochSecond(&dt, 0);
+    for (uint32_t z = 0; z < ARRAY_SIZE(zones); z++) {
+        for (int64_t epoch = startEpoch; epoch < endEpoch; epoch += 7 * SECONDS_PER_HOUR + 13) {
+            assert_int32(resolveTimeZoneOffsetYearCached(&cache, epoch, zones[z]), ==, resolveTimeZoneOffset(epoch, zones[z]));
+        }
+        for (uint32_t i = 0; i < zones[z]->ruleCount; i++) {    // around each transition, including gap of the previous rule
+            int64_t transition = zones[z]->rules[i].transition;
+            for (int64_t epoch = transition - 7200; epoch <= transition + 7200; epoch += 900) {
+                assert_int32(resolveTimeZoneOffsetYearCached(&cache, epoch, zones[z]), ==, resolveTimeZoneOffset(epoch, zones[z]));
+                assert_int32(resolveTimeZoneOffsetYearCached(&cache, epoch + 1, zones[z]), ==, resolveTimeZoneOffset(epoch + 1, zones[z]));
+            }
+        }
+    }
+
+    cache = (ZoneYearCache) {0};
+    const TimeZone *paris = zones[0];
+    dt = dateTimeOf(2022, 1, 1, 0, 0);
+    startEpoch = dateTimeToEpochSecond(&dt, 0);
+    for (int64_t epoch = startEpoch; epoch < startEpoch + 3 * 365 * SECONDS_PER_DAY; epoch += 600) {
+        resolveTimeZoneOffsetYearCached(&cache, epoch, paris);
+    }
+    assert_uint64(cache.misses, ==, 3);     // one fill per year
+    assert_ptr_equal(cache.zone, paris);
+    assert_uint8(cache.entryCount, ==, 3);
+    assert_uint8(cache.entries[0].segmentCount, ==, 3);
+    assert_int32(resolveTimeZoneOffsetYearCached(NULL, startEpoch, paris), ==, 3600);
+
+    dt = dateTimeOf(2013, 8, 1, 0, 0);      // daylight time suspended during Ramadan, four transitions in year
+    int64_t epoch = dateTimeToEpochSecond(&dt, 0);
+    assert_int32(resolveTimeZoneOffsetYearCached(&cache, epoch, zones[2]), ==, resolveTimeZoneOffset(epoch, zones[2]));
+    assert_uint8(cache.entryCount, ==, 1);
+    assert_uint8(cache.entries[0].segmentCount, ==, 0);
+    return MUNIT_OK;
+}
+
+static MunitResult testResolveTimeZoneOffsetBatch(const MunitParameter params[], void *data) {
+    const TimeZone *zones[] = {findTimeZone("Europe/Paris"), findTimeZone("Australia/Sydney"), findTimeZone("America/New_York"), &UTC};
+    int64_t epochs[512];
+    int32_t offsets[ARRAY_SIZE(epochs)];
+    DateTime dt = dateTimeOf(1900, 1, 1, 0, 0);
+    int64_t startEpoch = dateTimeToEpochSecond(&dt, 0);
+    for (uint32_t i = 0; i < ARRAY_SIZE(epochs); i++) {     // sorted, from 1900 to after the last zone rule
+        epochs[i] = startEpoch + (int64_t) i * 143 * 86413;
+    }
+
+    for (uint32_t z = 0; z < ARRAY_SIZE(zones); z++) {
+        resolveTimeZoneOffsetBatch(epochs, ARRAY_SIZE(epochs), zones[z], offsets);
+        for (uint32_t i = 0; i < ARRAY_SIZE(epochs); i++) {
+            assert_int32(offsets[i], ==, resolveTimeZoneOffset(epochs[i], zones[z]));
+        }
+    }
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(epochs); i++) {     // unsorted
+        epochs[i] = startEpoch + (int64_t) ((i * 7919U) % ARRAY_SIZE(epochs)) * 143 * 86413;
+    }
+    for (uint32_t z = 0; z < ARRAY_SIZE(zones); z++) {
+        resolveTimeZoneOffsetBatch(epochs, ARRAY_SIZE(epochs), zones[z], offsets);
+        for (uint32_t i = 0; i < ARRAY_SIZE(epochs); i++) {
+            assert_int32(offsets[i], ==, resolveTimeZoneOffset(epochs[i], zones[z]));
+        }
+    }
+
+    const TimeZone *paris = findTimeZone("Europe/Paris");
+    for (uint32_t i = 0; i < paris->ruleCount && i < ARRAY_SIZE(epochs) / 2; i++) {    // around each transition
+        epochs[2 * i] = paris->rules[i].transition;
+        epochs[2 * i + 1] = paris->rules[i].transition + 1;
+    }
+    uint32_t count = (paris->ruleCount < ARRAY_SIZE(epochs) / 2) ? paris->ruleCount * 2 : ARRAY_SIZE(epochs);
+    resolveTimeZoneOffsetBatch(epochs, count, paris, offsets);
+    for (uint32_t i = 0; i < count; i++) {
+        assert_int32(offsets[i], ==, resolveTimeZoneOffset(epochs[i], paris));
+    }
+
+    TimeZoneRule decodedRules[2];   // around recurring rule transitions, pair is reused inside its window
+    int64_t transition = paris->rules[paris->ruleCount - 1].transition;
+    for (uint32_t i = 0; i < ARRAY_SIZE(epochs); i += 2) {
+        transition = findRecurringRuleTransition(transition + 1, paris, decodedRules).after->transition;
+        epochs[i] = transition - 1;
+        epochs[i + 1] = transition;
+    }
+    resolveTimeZoneOffsetBatch(epochs, ARRAY_SIZE(epochs), paris, offsets);
+    for (uint32_t i = 0; i < ARRAY_SIZE(epochs); i++) {
+        assert_int32(offsets[i], ==, resolveTimeZoneOffset(epochs[i], paris));
+    }
+    resolveTimeZoneOffsetBatch(epochs, 0, paris, NULL);
+    return MUNIT_OK;
+}
+
+static bool isZoneIndexFound(const uint16_t *zoneIndexes, uint16_t count, uint16_t zoneIndex) {
+    for (uint16_t i = 0; i < count; i++) {
+        if (zoneIndexes[i] == zoneIndex) return true;
+    }
+    return false;
+}
+
+static MunitResult testZoneOffsetIndex(const MunitParameter params[], void *data) {
+    static ZoneOffsetEntry entries[1024];
+    static uint16_t zoneIndexes[1024];
+    ZoneOffsetIndex index;
+    assert_false(initZoneOffsetIndex(&index, entries, getTimeZoneCount() - 1));
+    assert_true(initZoneOffsetIndex(&index, entries, ARRAY_SIZE(entries)));
+
+    DateTime dt = dateTimeOf(2022, 3, 26, 22, 0);  // Europe daylight time starts at 2022-03-27T01:00:00Z
+    int64_t startEpoch = dateTimeToEpochSecond(&dt, 0);
+    dt = dateTimeOf(2200, 3, 29, 22, 0);    // recurring rules, transitions past 32-bit seconds
+    int64_t startEpochs[] = {startEpoch, dateTimeToEpochSecond(&dt, 0)};
+    int32_t offsets[] = {3600, 7200, -18000, 19800, 20700};
+    for (uint32_t s = 0; s < ARRAY_SIZE(startEpochs); s++) {
+        for (int64_t epoch = startEpochs[s]; epoch < startEpochs[s] + 6 * SECONDS_PER_HOUR; epoch += 1800) {
+            for (uint32_t i = 0; i < ARRAY_SIZE(offsets); i++) {
+                const ZoneOffsetEntry *zoneEntries;
+                uint16_t count = findZonesWithOffset(&index, epoch, offsets[i], &zoneEntries);
+                uint16_t expectedCount = 0;
+                for (uint16_t zoneIndex = 0; zoneIndex < getTimeZoneCount(); zoneIndex++) {
+                    if (resolveTimeZoneOffset(epoch, getTimeZoneByIndex(zoneIndex)) == offsets[i]) {
+                        expectedCount++;
+                    }
+                }
+                assert_uint16(count, ==, expectedCount);
+                for (uint16_t j = 0; j < count; j++) {
+                    assert_int32(resolveTimeZoneOffset(epoch, getTimeZoneByIndex(zoneEntries[j].zoneIndex)), ==, offsets[i]);
+                }
+            }
+        }
+    }
+    const ZoneOffsetEntry *zoneEntries;
+    dt = dateTimeOf(2022, 7, 1, 12, 0);
+    assert_uint16(findZonesWithOffset(&index, dateTimeToEpochSecond(&dt, 0), 7200, &zoneEntries), >, 0);
+    assert_uint16(findZonesWithOffset(&index, dateTimeToEpochSecond(&dt, 0), 7201, &zoneEntries), ==, 0);
+
+    int32_t secondsOfDay[] = {9 * SECONDS_PER_HOUR, 2 * SECONDS_PER_HOUR + 30 * SECONDS_PER_MINUTE, 0};
+    int64_t windows[][2] = {{startEpoch, startEpoch + 60}, {startEpoch, startEpoch + 5 * SECONDS_PER_HOUR}, {startEpoch + 7 * SECONDS_PER_HOUR, startEpoch + 8 * SECONDS_PER_HOUR}};
+    for (uint32_t i = 0; i < ARRAY_SIZE(secondsOfDay); i++) {
+        for (uint32_t w = 0; w < ARRAY_SIZE(windows); w++) {
+            uint16_t count = findZonesCrossingLocalTime(&index, windows[w][0], windows[w][1], secondsOfDay[i], zoneIndexes, ARRAY_SIZE(zoneIndexes));
+            uint16_t expectedCount = 0;
+            for (uint16_t zoneIndex = 0; zoneIndex < getTimeZoneCount(); zoneIndex++) {   // all offsets are whole minutes
+                bool isCrossing = false;
+                for (int64_t epoch = windows[w][0]; epoch < windows[w][1] && !isCrossing; epoch += 60) {
+                    int64_t localEpoch = epoch + resolveTimeZoneOffset(epoch, getTimeZoneByIndex(zoneIndex));
+                    isCrossing = floorMod(localEpoch, SECONDS_PER_DAY) == secondsOfDay[i];
+                }
+                assert_true(isCrossing == isZoneIndexFound(zoneIndexes, count, zoneIndex));
+                expectedCount += isCrossing;
+            }
+            assert_uint16(count, ==, expectedCount);
+        }
+    }
+
+    uint16_t count = findZonesCrossingLocalTime(&index, startEpoch, startEpoch + SECONDS_PER_HOUR, 0, zoneIndexes, 2);
+    assert_uint16(count, ==, 2);
+    return MUNIT_OK;
+}
+
+static MunitResult testCompactTimeZoneRules(const MunitParameter params[], void *data) {
+    const TimeZone *zone = findTimeZone("America/New_York");
+    uint32_t transitionDeltas[256];
+    uint8_t offsetTypeIndexes[256];
+    ZoneOffsetType offsetTypes[4];
+    CompactTimeZoneRules compactRules;
+    assert_true(packTimeZoneRules(zone->rules, zone->ruleCount, &compactRules, transitionDeltas, offsetTypeIndexes, offsetTypes, ARRAY_SIZE(offsetTypes)));
+    assert_uint16(compactRules.ruleCount, ==, zone->ruleCount);
+    assert_uint8(compactRules.offsetTypeCount, ==, 2);  // EST and EDT
+
+    for (uint32_t i = 0; i < zone->ruleCount; i++) {
+        int64_t transition = zone->rules[i].transition;
+        for (int64_t epoch = transition - 3600; epoch <= transition + 3600; epoch += 1800) {
+            TimeZoneRule decodedRules[2];
+            ZoneTransition expected = findZoneRuleTransition(epoch, zone);
+            ZoneTransition result = findCompactZoneRuleTransition(epoch, &compactRules, decodedRules);
+            if (expected.before == NULL) {
+                assert_null(result.before);
+                assert_null(result.after);
+            } else {
+                assert_int64(result.before->transition, ==, expected.before->transition);
+                assert_int32(result.before->gmtOffset, ==, expected.before->gmtOffset);
+                assert_int(result.before->isDaylightTime, ==, expected.before->isDaylightTime);
+                assert_int64(result.after->transition, ==, expected.after->transition);
+            }
+            assert_int32(resolveCompactTimeZoneOffset(epoch, &compactRules, zone), ==, resolveTimeZoneOffset(epoch, zone));
+        }
+    }
+
+    TimeZoneRule unpackedRules[256];
+    assert_true(unpackTimeZoneRules(&compactRules, unpackedRules, ARRAY_SIZE(unpackedRules)));
+    for (uint32_t i = 0; i < zone->ruleCount; i++) {
+        assert_int64(unpackedRules[i].transition, ==, zone->rules[i].transition);
+        assert_int32(unpackedRules[i].gmtOffset, ==, zone->rules[i].gmtOffset);
+        assert_int(unpackedRules[i].isDaylightTime, ==, zone->rules[i].isDaylightTime);
+    }
+    assert_false(unpackTimeZoneRules(&compactRules, unpackedRules, zone->ruleCount - 1));
+
+    assert_false(packTimeZoneRules(zone->rules, zone->ruleCount, &compactRules, transitionDeltas, offsetTypeIndexes, offsetTypes, 1));
+    return MUNIT_OK;
+}
+
+static MunitResult testVarintTimeZoneRules(const MunitParameter params[], void *data) {
+    static uint8_t varintData[1024 * VARINT_RULE_MAX_LENGTH];
+    static TimeZoneRule decodedRules[1024];
+    ZoneOffsetType offsetTypes[16];
+    VarintTimeZoneRules varintRules;
+    for (uint16_t z = 0; z < getTimeZoneCount(); z++) {     // round trip of each zone table
+        const TimeZone *zone = getTimeZoneByIndex(z);
+        if (zone->ruleCount == 0) continue;
+        assert_true(packVarintTimeZoneRules(zone->rules, zone->ruleCount, &varintRules, varintData, sizeof(varintData), offsetTypes, ARRAY_SIZE(offsetTypes)));
+        assert_uint16(varintRules.ruleCount, ==, zone->ruleCount);
+        assert_uint32(varintRules.dataLength, <=, zone->ruleCount * 4 + VARINT_RULE_MAX_LENGTH);     // first transition is absolute
+        assert_true(unpackVarintTimeZoneRules(&varintRules, decodedRules, ARRAY_SIZE(decodedRules)));
+        for (uint32_t i = 0; i < zone->ruleCount; i++) {
+            assert_int64(decodedRules[i].transition, ==, zone->rules[i].transition);
+            assert_int32(decodedRules[i].gmtOffset, ==, zone->rules[i].gmtOffset);
+            assert_int(decodedRules[i].isDaylightTime, ==, zone->rules[i].isDaylightTime);
+        }
+    }
+
+    const TimeZone *zone = findTimeZone("America/New_York");
+    assert_true(packVarintTimeZoneRules(zone->rules, zone->ruleCount, &varintRules, varintData, sizeof(varintData), offsetTypes, ARRAY_SIZE(offsetTypes)));
+    assert_uint8(varintRules.offsetTypeCount, ==, 2);  // EST and EDT
+    assert_uint8(varintRules.offsetIndexBits, ==, 1);
+    assert_false(unpackVarintTimeZoneRules(&varintRules, decodedRules, zone->ruleCount - 1));
+
+    VarintTimeZoneRules truncatedRules = varintRules;
+    truncatedRules.dataLength--;
+    assert_false(unpackVarintTimeZoneRules(&truncatedRules, decodedRules, ARRAY_SIZE(decodedRules)));
+    VarintTimeZoneRules wrongPaletteRules = varintRules;
+    wrongPaletteRules.offsetTypeCount = 1;
+    assert_false(unpackVarintTimeZoneRules(&wrongPaletteRules, decodedRules, ARRAY_SIZE(decodedRules)));
+
+    assert_false(packVarintTimeZoneRules(zone->rules, zone->ruleCount, &varintRules, varintData, 16, offsetTypes, ARRAY_SIZE(offsetTypes)));
+    assert_false(packVarintTimeZoneRules(zone->rules, zone->ruleCount, &varintRules, varintData, sizeof(varintData), offsetTypes, 1));
+    return MUNIT_OK;
+}
+
+static MunitResult testParseZoneRecurringRule(const MunitParameter params[], void *data) {
+    ZoneRecurringRule rule;
+    assert_true(parseZoneRecurringRule("CET-1CEST,M3.5.0,M10.5.0/3", &rule));
+    assert_int32(rule.standardOffset, ==, 3600);
+    assert_int32(rule.daylightOffset, ==, 7200);
+    assert_true(rule.hasDaylightTime);
+    assert_int(rule.daylightStart.type, ==, RECURRING_DATE_MONTH_WEEK_DAY);
+    assert_uint8(rule.daylightStart.month, ==, 3);
+    assert_uint8(rule.daylightStart.week, ==, 5);
+    assert_uint16(rule.daylightStart.day, ==, 0);
+    assert_int32(rule.daylightStart.secondOfDay, ==, 7200);
+    assert_int32(rule.daylightEnd.secondOfDay, ==, 10800);
+
+    assert_true(parseZoneRecurringRule("EST5EDT", &rule));  // default US dates
+    assert_int32(rule.standardOffset, ==, -18000);
+    assert_int32(rule.daylightOffset, ==, -14400);
+    assert_uint8(rule.daylightStart.month, ==, 3);
+    assert_uint8(rule.daylightStart.week, ==, 2);
+    assert_uint8(rule.daylightEnd.month, ==, 11);
+
+    assert_true(parseZoneRecurringRule("<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45", &rule));
+    assert_int32(rule.standardOffset, ==, 45900);
+    assert_int32(rule.daylightOffset, ==, 49500);
+    assert_int32(rule.daylightStart.secondOfDay, ==, 9900);
+
+    assert_true(parseZoneRecurringRule("<-03>3<-02>2,J60/-1,300/26:30", &rule));
+    assert_int32(rule.daylightOffset, ==, -7200);
+    assert_int(rule.daylightStart.type, ==, RECURRING_DATE_JULIAN_DAY);
+    assert_uint16(rule.daylightStart.day, ==, 60);
+    assert_int32(rule.daylightStart.secondOfDay, ==, -3600);
+    assert_int(rule.daylightEnd.type, ==, RECURRING_DATE_ZERO_BASED_DAY);
+    assert_int32(rule.daylightEnd.secondOfDay, ==, 95400);
+
+    assert_true(parseZoneRecurringRule("<+03>-3", &rule));
+    assert_int32(rule.standardOffset, ==, 10800);
+    assert_false(rule.hasDaylightTime);
+
+    assert_false(parseZoneRecurringRule("", &rule));
+    assert_false(parseZoneRecurringRule("CE-1", &rule));
+    assert_false(parseZoneRecurringRule("CET", &rule));
+    assert_false(parseZoneRecurringRule("CET-1CEST,M13.1.0,M10.5.0", &rule));
+    assert_false(parseZoneRecurringRule("CET-1CEST,M3.5.0", &rule));
+    assert_false(parseZoneRecurringRule("CET-1CEST,M3.5.0,M10.5.0/3 ", &rule));
+    assert_false(parseZoneRecurringRule(NULL, &rule));
+    return MUNIT_OK;
+}
+
+static MunitResult testFindRecurringRuleTransition(const MunitParameter params[], void *data) {
+    const TimeZone *zone = findTimeZone("Europe/Paris");
+    assert_not_null(zone->recurringRule);
+    DateTime dt = dateTimeOf(2100, 3, 28, 0, 59);   // after the last zone rule
+    int64_t epoch = dateTimeToEpochSecond(&dt, 0);
+    assert_int32(resolveTimeZoneOffset(epoch, zone), ==, 3600);
+    assert_string_equal(resolveTimeZoneName(epoch, zone, ZONE_NAME_SHORT), "CET");
+    dt = dateTimeOf(2100, 7, 1, 12, 0);
+    epoch = dateTimeToEpochSecond(&dt, 0);
+    assert_int32(resolveTimeZoneOffset(epoch, zone), ==, 7200);
+    assert_string_equal(resolveTimeZoneName(epoch, zone, ZONE_NAME_SHORT), "CEST");
+    dt = dateTimeOf(2100, 10, 31, 1, 0);    // winter time starts at transition instant
+    epoch = dateTimeToEpochSecond(&dt, 0);
+    assert_int32(resolveTimeZoneOffset(epoch - 1, zone), ==, 7200);
+    assert_int32(resolveTimeZoneOffset(epoch, zone), ==, 3600);
+    dt = dateTimeOf(2100, 11, 1, 12, 0);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), zone), ==, 3600);
+
+    TimeZoneRule decodedRules[2];
+    ZoneTransition transition = findRecurringRuleTransition(epoch, zone, decodedRules);
+    assert_ptr_equal(transition.after, &decodedRules[1]);
+    assert_int64(transition.after->transition, ==, epoch);
+    assert_false(transition.after->isDaylightTime);
+    assert_true(transition.before->isDaylightTime);
+    dt = dateTimeOf(2008, 4, 12, 7, 23);    // inside zone rules
+    transition = findRecurringRuleTransition(dateTimeToEpochSecond(&dt, 0), zone, decodedRules);
+    assert_null(transition.before);
+
+    zone = findTimeZone("Australia/Sydney");    // southern hemisphere, daylight time at the start of year
+    dt = dateTimeOf(2200, 1, 1, 0, 0);
+    epoch = dateTimeToEpochSecond(&dt, 0);
+    assert_int32(resolveTimeZoneOffset(epoch, zone), ==, 39600);
+    transition = findRecurringRuleTransition(epoch, zone, decodedRules);    // daylight time started in previous year
+    assert_true(transition.before->isDaylightTime);
+    assert_int64(transition.before->transition, <, epoch);
+    assert_false(transition.after->isDaylightTime);
+    assert_int64(transition.after->transition, >, epoch);
+    dt = dateTimeOf(2200, 7, 1, 0, 0);
+    assert_int32(resolveTimeZoneOffset(dateTimeToEpochSecond(&dt, 0), zone), ==, 36000);
+
+    zone = findTimeZone("Europe/Paris");    // recurring rule alone reproduces the latest zone rules
+    TimeZone recurringZone = {.id = zone->id, .utcOffset = zone->utcOffset, .names = zone->names, .recurringRule = zone->recurringRule};
+    for (uint32_t i = 0; i < zone->ruleCount; i++) {
+        int64_t transitionEpoch = zone->rules[i].transition;
+        if (transitionEpoch < 1893456000) continue;     // since 2030
+        for (epoch = transitionEpoch - 7200; epoch <= transitionEpoch + 7200; epoch += 1800) {
+            assert_int32(resolveTimeZoneOffset(epoch, &recurringZone), ==, resolveTimeZoneOffset(epoch, zone));
+        }
+    }
+    return MUNIT_OK;
+}
+
+static MunitResult testRecurringRulesContinueZoneRules(const MunitParameter params[], void *data) {
+    for (uint16_t i = 0; i < getTimeZoneCount(); i++) {     // recurring rule takes over from the last zone rule
+        const TimeZone *zone = getTimeZoneByIndex(i);
+        if (zone->recurringRule == NULL || zone->ruleCount == 0) continue;
+
+        const TimeZoneRule *lastRule = &zone->rules[zone->ruleCount - 1];
+        TimeZone recurringZone = {.id = zone->id, .utcOffset = zone->utcOffset, .recurringRule = zone->recurringRule};
+        for (int64_t epoch = lastRule->transition; epoch <= lastRule->transition + SECONDS_PER_DAY; epoch += SECONDS_PER_HOUR) {
+            if (resolveTimeZoneOffset(epoch, &recurringZone) != lastRule->gmtOffset) {
+                munit_errorf("%s: recurring rule differs from the last zone rule at %" PRId64, zone->id, epoch);
+            }
+        }
+    }
+    return MUNIT_OK;
+}
+
+static MunitResult testResolveLocalZoneOffsets(const MunitParameter params[], void *data) {
+    const TimeZone *zone = findTimeZone("Europe/Paris");
+    DateTime dt = dateTimeOf(2022, 7, 1, 12, 0);
+    LocalZoneOffsets result = resolveLocalZoneOffsets(dateTimeToEpochSecond(&dt, 0), NULL, zone);
+    assert_uint8(result.offsetCount, ==, 1);
+    assert_int32(result.offsets[0], ==, 7200);
+
+    dt = dateTimeOf(2022, 3, 27, 2, 30);    // gap, clocks move from 02:00 to 03:00
+    result = resolveLocalZoneOffsets(dateTimeToEpochSecond(&dt, 0), NULL, zone);
+    assert_uint8(result.offsetCount, ==, 0);
+    assert_int32(result.offsets[0], ==, 3600);
+    assert_int32(result.offsets[1], ==, 7200);
+    dt = dateTimeOf(2022, 3, 27, 1, 0);
+    assert_int64(result.transition, ==, dateTimeToEpochSecond(&dt, 0));
+
+    dt = dateTimeOf(2022, 10, 30, 2, 30);   // overlap, clocks move from 03:00 back to 02:00
+    result = resolveLocalZoneOffsets(dateTimeToEpochSecond(&dt, 0), NULL, zone);
+    assert_uint8(result.offsetCount, ==, 2);
+    assert_int32(result.offsets[0], ==, 7200);
+    assert_int32(result.offsets[1], ==, 3600);
+    dt = dateTimeOf(2022, 10, 30, 1, 0);
+    assert_int64(result.transition, ==, dateTimeToEpochSecond(&dt, 0));
+    dt = dateTimeOf(2022, 10, 30, 3, 0);
+    result = resolveLocalZoneOffsets(dateTimeToEpochSecond(&dt, 0), NULL, zone);
+    assert_uint8(result.offsetCount, ==, 1);
+    assert_int32(result.offsets[0], ==, 3600);
+
+    dt = dateTimeOf(2100, 3, 28, 2, 30);    // gap and overlap from recurring rule
+    assert_uint8(resolveLocalZoneOffsets(dateTimeToEpochSecond(&dt, 0), NULL, zone).offsetCount, ==, 0);
+    dt = dateTimeOf(2100, 10, 31, 2, 30);
+    assert_uint8(resolveLocalZoneOffsets(dateTimeToEpochSecond(&dt, 0), NULL, zone).offsetCount, ==, 2);
+
+    static LocalZoneTransition transitions[512];
+    LocalZoneRules localRules;
+    assert_false(buildLocalZoneRules(zone, transitions, zone->ruleCount - 2, &localRules));
+    assert_true(buildLocalZoneRules(zone, transitions, ARRAY_SIZE(transitions), &localRules));
+    assert_uint16(localRules.transitionCount, ==, zone->ruleCount - 1);
+    for (uint32_t i = 0; i < zone->ruleCount; i++) {   // precomputed rules resolve the same offsets
+        int64_t transitionEpoch = zone->rules[i].transition;
+        for (int64_t local = transitionEpoch - 3 * 3600; local <= transitionEpoch + 3 * 3600; local += 900) {
+            LocalZoneOffsets expected = resolveLocalZoneOffsets(local, NULL, zone);
+            result = resolveLocalZoneOffsets(local, &localRules, zone);
+            assert_uint8(result.offsetCount, ==, expected.offsetCount);
+            assert_int32(result.offsets[0], ==, expected.offsets[0]);
+            assert_int32(result.offsets[1], ==, expected.offsets[1]);
+        }
+    }
+
+    result = resolveLocalZoneOffsets(0, NULL, &UTC);    // zone without rules
+    assert_uint8(result.offsetCount, ==, 1);
+    assert_int32(result.offsets[0], ==, 0);
+    return MUNIT_OK;
+}
+
 static MunitTest timeZoneTests[] = {
         {.name =  "Test findTimeZone() - should validate and find time zone struct", .test = testZoneOf},
+        {.name =  "Test findTimeZoneWithLength() - should find zone by id slice", .test = testFindTimeZoneWithLength},
+        {.name =  "Test findZoneNameCandidates() - should find zones and offsets by zone name", .test = testFindZoneNameCandidates},
+        {.name =  "Test getCanonicalTimeZone() - should resolve alias to link target", .test = testTimeZoneLinks},
+        {.name =  "Test zoneHandleOf() - should resolve zone handles and compare them", .test = testZoneHandles},
         {.name =  "Test resolveTimeZoneOffset() - should correctly resolve zone offset", .test = testResolveTimeZoneOffset},
+        {.name =  "Test resolveTimeZoneOffset() - should resolve zone offset for transitions before 1970", .test = testResolveTimeZoneOffsetBefore1970},
+        {.name =  "Test findZoneRuleTransition() - should find the same transition as linear scan", .test = testFindZoneRuleTransition},
+        {.name =  "Test findIndexedZoneRuleTransition() - should find the same transition as binary search", .test = testFindIndexedZoneRuleTransition},
+        {.name =  "Test resolveTimeZoneOffsetCached() - should resolve same offset as without cache", .test = testResolveTimeZoneOffsetCached},
+        {.name =  "Test resolveTimeZoneOffsetYearCached() - should resolve same offset as without cache", .test = testResolveTimeZoneOffsetYearCached},
+        {.name =  "Test resolveTimeZoneOffsetBatch() - should resolve same offsets as one by one", .test = testResolveTimeZoneOffsetBatch},
+        {.name =  "Test findZonesWithOffset() - should find zones by offset and local time", .test = testZoneOffsetIndex},
+        {.name =  "Test findCompactZoneRuleTransition() - should resolve same rules from packed table", .test = testCompactTimeZoneRules},
+        {.name =  "Test unpackVarintTimeZoneRules() - should decode same rules from compressed table", .test = testVarintTimeZoneRules},
+        {.name =  "Test parseZoneRecurringRule() - should parse POSIX TZ string", .test = testParseZoneRecurringRule},
+        {.name =  "Test findRecurringRuleTransition() - should resolve daylight time after the last zone rule", .test = testFindRecurringRuleTransition},
+        {.name =  "Test zone recurring rules - should continue the last zone rule", .test = testRecurringRulesContinueZoneRules},
+        {.name =  "Test resolveLocalZoneOffsets() - should resolve gap and overlap of local date-time", .test = testResolveLocalZoneOffsets},
         {.name =  "Test resolveTimeZoneName() - should correctly resolve zone name with style", .test = testResolveTimeZoneName},
         END_OF_TESTS
 };
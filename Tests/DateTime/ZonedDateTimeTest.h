@@ -22,8 +22,9 @@ static void checkZonedDateTime(ZonedDateTime test,
     assert_int8(test.dateTime.time.minutes, ==, minute);
     assert_int8(test.dateTime.time.seconds, ==, seconds);
     assert_int(test.dateTime.time.millis, ==, millis);
-    assert_int(test.zone.utcOffset, ==, zone.utcOffset);
-    assert_string_equal(test.zone.id, zone.id);
+    TimeZone testZone = getZonedDateTimeZone(&test);
+    assert_int(testZone.utcOffset, ==, zone.utcOffset);
+    assert_string_equal(testZone.id, zone.id);
 }
 
 static void assertZonedDateTimeEquals(ZonedDateTime test, ZonedDateTime expected) {
@@ -57,6 +58,95 @@ static MunitResult testZonedDateTimeFactories(const MunitParameter params[], voi
     return MUNIT_OK;
 }
 
+static MunitResult testZonedDateTimeZoneHandle(const MunitParameter params[], void *data) {
+    assert_size(sizeof(ZonedDateTime), <=, sizeof(DateTime) + 8 + sizeof(const TimeZone *));     // instead of zone copy
+
+    ZonedDateTime alias = zonedDateTimeOf(2022, 7, 1, 12, 0, 0, 0, findTimeZone("America/Atka"));
+    ZonedDateTime canonical = zonedDateTimeOf(2022, 7, 1, 12, 0, 0, 0, findTimeZone("America/Adak"));
+    assert_true(isZonedDateTimeEquals(&alias, &canonical));
+    assert_string_equal(getZonedDateTimeZone(&alias).id, "America/Atka");
+
+    TimeZone offsetZone = {.id = "UTC", .utcOffset = 7200, .names = UTC_ZONE_NAMES};
+    ZonedDateTime fixed = zonedDateTimeOf(2022, 7, 1, 12, 0, 0, 0, &offsetZone);
+    assert_int32(fixed.offset, ==, 7200);
+    zonedDateTimePlusMonths(&fixed, 6);
+    assert_int32(fixed.offset, ==, 7200);
+    TimeZone fixedZone = getZonedDateTimeZone(&fixed);
+    assert_string_equal(fixedZone.id, "UTC");
+    assert_int32(fixedZone.utcOffset, ==, 7200);
+
+    ZonedDateTime uninitialized = zonedDateTimeOfDateTime(NULL, &offsetZone);
+    assert_null(getZonedDateTimeZone(&uninitialized).id);
+
+    static const TimeZoneRule customRules[] = {{.transition = 1648342800, .gmtOffset = 7200}, {.transition = 1667091600, .gmtOffset = 3600}};
+    TimeZone customZones[40];     // any count of zones outside ZONE_LIST keeps its zone
+    for (int i = 0; i < ARRAY_SIZE(customZones); i++) {
+        customZones[i] = (TimeZone) {.id = "Custom_Zone", .utcOffset = 3600, .rules = customRules, .ruleCount = ARRAY_SIZE(customRules)};
+        ZonedDateTime custom = zonedDateTimeOf(2022, 7, 1, 12, 0, 0, 0, &customZones[i]);
+        assert_uint16(custom.zone, ==, ZONE_HANDLE_EXTERNAL);
+        assert_ptr_equal(custom.externalZone, &customZones[i]);
+        assert_int32(custom.offset, ==, 7200);
+        zonedDateTimePlusMonths(&custom, 6);
+        assert_int32(custom.offset, ==, 3600);
+        assert_string_equal(getZonedDateTimeZone(&custom).id, "Custom_Zone");
+    }
+    return MUNIT_OK;
+}
+
+static MunitResult testZonedDateTimeOfInstantCached(const MunitParameter params[], void *data) {
+    const TimeZone *zone = findTimeZone("Europe/Paris");
+    ZoneTransitionCache cache = {0};
+    DateTime dt = dateTimeOf(2021, 1, 1, 0, 0);
+    int64_t startEpoch = dateTimeToEpochSecond(&dt, 0);
+    for (int64_t epoch = startEpoch; epoch < startEpoch + (2LL * 366 * SECONDS_PER_DAY); epoch += 3599) {
+        Instant instant = instantOfEpochSeconds(epoch);
+        ZonedDateTime expected = zonedDateTimeOfInstant(&instant, zone);
+        ZonedDateTime test = zonedDateTimeOfInstantCached(&instant, zone, &cache);
+        assertZonedDateTimeEquals(test, expected);
+    }
+    assert_uint64(cache.hits, >, cache.misses);
+    return MUNIT_OK;
+}
+
+static MunitResult testZonedDateTimeOfInstantRoundTrip(const MunitParameter params[], void *data) {
+    const TimeZone *zone = findTimeZone("Europe/Paris");
+    DateTime transitionDays[] = {dateTimeOf(2021, 3, 28, 0, 0), dateTimeOf(2021, 10, 31, 0, 0)};
+    for (uint32_t i = 0; i < ARRAY_SIZE(transitionDays); i++) {
+        for (DateTime dt = transitionDays[i]; dt.date.day == transitionDays[i].date.day; dateTimePlusMinutes(&dt, 1)) {
+            ZonedDateTime local = zonedDateTimeOfDateTime(&dt, zone);
+            Instant instant = instantOfEpochSeconds(dateTimeToEpochSecond(&local.dateTime, local.offset));
+            assert_int32(zonedDateTimeOfInstant(&instant, zone).offset, ==, local.offset);
+        }
+    }
+
+    ZonedDateTime local = zonedDateTimeOf(2021, 10, 31, 3, 21, 0, 0, zone);     // shortly after the overlap
+    Instant instant = instantOfEpochSeconds(dateTimeToEpochSecond(&local.dateTime, local.offset));
+    assert_int64(instant.seconds, ==, 1635646860);
+    assert_int32(local.offset, ==, 3600);
+    assert_int32(zonedDateTimeOfInstant(&instant, zone).offset, ==, 3600);
+    return MUNIT_OK;
+}
+
+static MunitResult testZonedDateTimeOfDateTimeWithRules(const MunitParameter params[], void *data) {
+    const TimeZone *zone = findTimeZone("Europe/Paris");
+    static LocalZoneTransition transitions[512];
+    LocalZoneRules localRules;
+    assert_true(buildLocalZoneRules(zone, transitions, ARRAY_SIZE(transitions), &localRules));
+    for (DateTime dt = dateTimeOf(2022, 1, 1, 0, 30); dt.date.year == 2022; dateTimePlusHours(&dt, 1)) {
+        assertZonedDateTimeEquals(zonedDateTimeOfDateTimeWithRules(&dt, zone, &localRules), zonedDateTimeOfDateTime(&dt, zone));
+    }
+
+    DateTime dt = dateTimeOf(2022, 3, 27, 2, 30);   // gap
+    ZonedDateTime test = zonedDateTimeOfDateTimeWithRules(&dt, zone, &localRules);
+    checkZonedDateTime(test, 2022, 3, 27, 3, 30, 0, 0, ZONE_PARIS);
+    assert_int32(test.offset, ==, 7200);
+    dt = dateTimeOf(2022, 10, 30, 2, 30);   // overlap keeps the earlier offset
+    test = zonedDateTimeOfDateTimeWithRules(&dt, zone, &localRules);
+    checkZonedDateTime(test, 2022, 10, 30, 2, 30, 0, 0, ZONE_PARIS);
+    assert_int32(test.offset, ==, 7200);
+    return MUNIT_OK;
+}
+
 static MunitResult testZonedDateTimeWithSameInstant(const MunitParameter params[], void *data) {
     /* March -> 03
     Paris: 01:30, 27 Mar. 2022  -> no gap
@@ -255,6 +345,10 @@ static MunitResult testZonedDateMinusMillis(const MunitParameter params[], void
 
 static MunitTest zonedDateTimeTests[] = {
         {.name =  "Test zonedDateTimeOf() - should validate and create zoned date-time", .test = testZonedDateTimeFactories},
+        {.name =  "Test getZonedDateTimeZone() - should keep zone as compact handle", .test = testZonedDateTimeZoneHandle},
+        {.name =  "Test zonedDateTimeOfInstantCached() - should create same zoned date-time as without cache", .test = testZonedDateTimeOfInstantCached},
+        {.name =  "Test zonedDateTimeOfInstant() - should resolve the same offset as local date-time around transitions", .test = testZonedDateTimeOfInstantRoundTrip},
+        {.name =  "Test zonedDateTimeOfDateTimeWithRules() - should create same zoned date-time as without local rules", .test = testZonedDateTimeOfDateTimeWithRules},
         {.name =  "Test zonedDateTimeWithSameInstant() - should create new zoned date-time according to rules", .test = testZonedDateTimeWithSameInstant},
 
         {.name =  "Test zonedDateTimePlusYears() - should correctly add years to zoned date-time", .test = testZonedDatePlusYears},
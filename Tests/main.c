@@ -4,6 +4,8 @@
 #include "DateTime/LocalDateTimeTest.h"
 #include "DateTime/ZonedDateTimeTest.h"
 #include "DateTime/TimeZoneTest.h"
+#include "DateTime/TimeZoneLoaderTest.h"
+#include "DateTime/TimeZoneOffsetTableTest.h"
 #include "DateTime/GlobalDateTimeTest.h"
 
 int main(int argc, char *argv[MUNIT_ARRAY_PARAM(argc + 1)]) {
@@ -15,7 +17,10 @@ int main(int argc, char *argv[MUNIT_ARRAY_PARAM(argc + 1)]) {
             dateTimeTestSuite,
             zonedDateTimeTestSuite,
             timeZoneTestSuite,
-            dateTimeFormatterTestSuite
+            timeZoneLoaderTestSuite,
+            timeZoneOffsetTableTestSuite,
+            dateTimeFormatterTestSuite,
+            {NULL, NULL, NULL, 0, MUNIT_SUITE_OPTION_NONE}
     };
 
     MunitSuite baseSuite = {
@@ -1,87 +1,1183 @@
+#include <ctype.h>
+#include <stdlib.h>
+
 #include "TimeZone.h"
+#include "TimeZoneIdHash.h"
+#include "TimeZoneNameHash.h"
+#include "TimeZoneRulesCache.h"
+#include "LocalDate.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ZONE_SEARCH_X86_KERNELS     // compiled with target attributes, selected at runtime
+#include <immintrin.h>
+#endif
 
 #define ARRAY_SIZE(arr) (sizeof(arr) / sizeof((arr)[0]))
 #define ZONE_NOT_FOUND  (-1)
 
+#define RECURRING_DEFAULT_DATES ",M3.2.0,M11.1.0"   // POSIX default when rule has no dates, same as US rules
+#define RECURRING_DEFAULT_SECOND_OF_DAY (2 * SECONDS_PER_HOUR)
+#define RECURRING_MAX_HOURS 167
+#define RECURRING_YEAR_TRANSITIONS 6    // two transitions for each of the previous, current and next years
+
+
+static int32_t findZoneIndexById(const char *id, uint32_t length);
+static const TimeZone *zoneOfIndex(uint16_t zoneIndex);
+static int32_t findCanonicalZoneIndex(const TimeZone *zone);
+static bool isSameZoneData(const TimeZone *zone, const TimeZone *other);
+static int32_t resolveTransitionOffset(ZoneTransition *transition, int64_t epochSeconds, const TimeZone *zone);
+static uint32_t resolveZoneRuleCount(const TimeZone *zone);
+static uint32_t findFirstRuleNotBefore(const TimeZoneRule *rules, uint32_t ruleCount, int64_t epochSeconds);
+static uint32_t advanceFirstRuleNotBefore(const TimeZoneRule *rules, uint32_t ruleCount, uint32_t ruleIndex, int64_t epochSeconds);
+static ZoneTransition zoneTransitionAt(const TimeZone *zone, uint32_t ruleCount, uint32_t ruleIndex);
+static uint32_t findFirstDeltaNotBefore(const CompactTimeZoneRules *compactRules, uint32_t delta);
+static void decodeCompactRule(const CompactTimeZoneRules *compactRules, uint32_t ruleIndex, TimeZoneRule *rule);
+static bool findOffsetTypeIndex(const TimeZoneRule *rule, ZoneOffsetType *offsetTypes, uint8_t *offsetTypeCount,
+                                uint8_t offsetTypesCapacity, uint8_t *typeIndex);
+static uint32_t writeVarint(uint64_t value, uint8_t *data);
+static uint32_t readVarint(const uint8_t *data, uint32_t length, uint64_t *value);
+static void fillTransitionBlocks(const TimeZoneRule *rules, uint32_t ruleCount, ZoneTransitionBlock *blocks, uint32_t blockCount, uint32_t blockIndex, uint32_t *ruleIndex);
+static uint32_t searchTransitionBlocks(const ZoneTransitionIndex *index, int64_t epochSeconds);
+#ifdef ZONE_SEARCH_X86_KERNELS
+static uint32_t searchTransitionBlocksSse42(const ZoneTransitionIndex *index, int64_t epochSeconds);
+static uint32_t searchTransitionBlocksAvx2(const ZoneTransitionIndex *index, int64_t epochSeconds);
+#endif
+static ZoneTransition findZoneTransition(ZoneTransitionCache *cache, int64_t epochSeconds, const TimeZone *zone, TimeZoneRule recurringRules[2]);
+static bool findCachedZoneTransition(ZoneTransitionCache *cache, int64_t epochSeconds, const TimeZone *zone, ZoneTransition *zoneTransition);
+static void storeCachedZoneTransition(ZoneTransitionCache *cache, const ZoneTransition *zoneTransition, const TimeZone *zone, bool isRecurring);
+static void buildRecurringRulesOfYear(const ZoneRecurringRule *recurringRule, int64_t year, TimeZoneRule yearRules[2]);
+static void buildRecurringYearRules(const ZoneRecurringRule *recurringRule, int64_t year, TimeZoneRule yearRules[RECURRING_YEAR_TRANSITIONS]);
+static void updateZoneOffsetIndex(ZoneOffsetIndex *index, int64_t epochSeconds);
+static int64_t findNextOffsetChange(int64_t epochSeconds, const TimeZone *zone);
+static int compareZoneOffsetEntries(const void *entry, const void *other);
+static uint16_t findFirstEntryNotBefore(const ZoneOffsetIndex *index, int64_t offset);
+static const ZoneYearEntry *findZoneYearEntry(const ZoneYearCache *cache, int64_t epochSeconds);
+static const ZoneYearEntry *fillZoneYearEntry(ZoneYearCache *cache, int64_t epochSeconds, const TimeZone *zone);
+static LocalZoneTransition localTransitionOf(const TimeZoneRule *rules, uint32_t ruleIndex);
+static bool findLocalZoneOffsets(int64_t localEpochSeconds, const LocalZoneRules *localRules, const TimeZoneRule *rules, uint32_t ruleCount, LocalZoneOffsets *localOffsets);
+static int64_t epochDayOfYearStart(int64_t year);
+static int64_t yearOfEpochDay(int64_t epochDay);
+static int64_t recurringDateToEpochSecond(const ZoneRecurringDate *date, int64_t year, int32_t offset);
+static bool parseRecurringZoneName(const char **text);
+static bool parseRecurringNumber(const char **text, uint32_t maxValue, uint32_t *value);
+static bool parseRecurringSeconds(const char **text, int32_t *seconds);
+static bool parseRecurringDate(const char **text, ZoneRecurringDate *date);
 
-static int32_t findZoneIndexById(const char *id);
 
 
 const TimeZone *findTimeZone(const char *zoneId) {
     if (zoneId == NULL) return NULL;
-    int32_t zoneIndex = findZoneIndexById(zoneId);
-    return zoneIndex == ZONE_NOT_FOUND ? NULL : &ZONE_LIST[zoneIndex];
+    return findTimeZoneWithLength(zoneId, strlen(zoneId));
+}
+
+const TimeZone *findTimeZoneWithLength(const char *zoneId, uint32_t length) {
+    if (zoneId == NULL) return NULL;
+    int32_t zoneIndex = findZoneIndexById(zoneId, length);
+    return zoneIndex == ZONE_NOT_FOUND ? NULL : zoneOfIndex(zoneIndex);
+}
+
+uint8_t findZoneNameCandidates(const char *name, uint32_t length, const ZoneNameCandidate **candidates) {
+    #ifdef ENABLE_TIME_ZONE_SUPPORT
+    if (name == NULL || candidates == NULL || length == 0) return 0;
+    uint32_t slot = zoneNameHashSlot(hashZoneId(name, length));
+    for (uint32_t i = 0; i < ZONE_NAME_HASH_SLOT_COUNT; i++) {     // table is never full, so probing stops at empty slot
+        uint16_t candidateIndex = ZONE_NAME_HASH_SLOTS[slot];
+        if (candidateIndex == ZONE_NAME_HASH_EMPTY_SLOT) break;
+        const ZoneNameCandidate *candidate = &ZONE_NAME_CANDIDATES[candidateIndex];
+        if (strncmp(candidate->name, name, length) == 0 && candidate->name[length] == '\0') {
+            *candidates = candidate;
+            return candidate->candidateCount;
+        }
+        slot = zoneNameHashSlot(slot + 1);
+    }
+    #else
+    (void) name;
+    (void) length;
+    (void) candidates;
+    #endif
+    return 0;
+}
+
+uint16_t getTimeZoneCount() {
+    return ZONE_LIST_LENGTH;
+}
+
+const TimeZone *getTimeZoneByIndex(uint16_t zoneIndex) {
+    return zoneIndex < ZONE_LIST_LENGTH ? zoneOfIndex(zoneIndex) : NULL;
 }
 
 int32_t resolveTimeZoneOffset(int64_t epochSeconds, const TimeZone *zone) {
-    ZoneTransition zoneTransition = findZoneRuleTransition(epochSeconds, zone);
-    if (zoneTransition.after != NULL && zoneTransition.before != NULL) {
-        if (isTransitionGap(&zoneTransition, epochSeconds)) {
-            return zoneTransition.after->gmtOffset;
+    return resolveTimeZoneOffsetCached(NULL, epochSeconds, zone);
+}
+
+int32_t resolveTimeZoneOffsetCached(ZoneTransitionCache *cache, int64_t epochSeconds, const TimeZone *zone) {
+    TimeZoneRule recurringRules[2];
+    ZoneTransition zoneTransition = findZoneTransition(cache, epochSeconds, zone, recurringRules);
+    return resolveTransitionOffset(&zoneTransition, epochSeconds, zone);
+}
+
+int32_t resolveTimeZoneOffsetYearCached(ZoneYearCache *cache, int64_t epochSeconds, const TimeZone *zone) {
+    if (cache == NULL) return resolveTimeZoneOffset(epochSeconds, zone);
+    if (cache->zone != zone) {
+        cache->zone = zone;
+        cache->entryCount = 0;
+        cache->nextEntryIndex = 0;
+    }
+
+    const ZoneYearEntry *entry = findZoneYearEntry(cache, epochSeconds);
+    if (entry != NULL) {
+        cache->hits++;
+    } else {
+        cache->misses++;
+        entry = fillZoneYearEntry(cache, epochSeconds, zone);
+    }
+
+    for (uint8_t i = 0; i < entry->segmentCount; i++) {
+        const ZoneYearSegment *segment = &entry->segments[i];
+        if (epochSeconds <= segment->lastEpochSecond) {
+            if (!segment->hasTransition) return zone->utcOffset;
+            ZoneTransition zoneTransition = {.before = &segment->before, .after = &segment->after};
+            return resolveTransitionOffset(&zoneTransition, epochSeconds, zone);
         }
-        return zoneTransition.before->gmtOffset;
     }
-    return zone->utcOffset;
+    return resolveTimeZoneOffset(epochSeconds, zone);   // year with more transitions than cached
 }
 
-const char *resolveTimeZoneName(int64_t epochSeconds, const TimeZone *zone, ZoneTextStyle textStyle) {
-    ZoneTransition zoneTransition = findZoneRuleTransition(epochSeconds, zone);
-    if (zoneTransition.before != NULL) {
-        if (zoneTransition.before->isDaylightTime) {
-            return (textStyle == ZONE_NAME_LONG) ? zone->names[ZONE_LONG_NAME_DTS_INDEX] : zone->names[ZONE_SHORT_NAME_DTS_INDEX];
+void resolveTimeZoneOffsetBatch(const int64_t *epochSeconds, size_t count, const TimeZone *zone, int32_t *offsets) {
+    uint32_t ruleCount = resolveZoneRuleCount(zone);
+    uint32_t ruleIndex = 0;
+    TimeZoneRule recurringRules[2];
+    ZoneTransition recurringTransition = {.before = NULL, .after = NULL};   // kept while epochs stay inside its window
+    for (size_t i = 0; i < count; i++) {
+        int64_t epoch = epochSeconds[i];
+        if (ruleCount > 1) {
+            bool isSorted = (i == 0) || epochSeconds[i - 1] <= epoch;   // otherwise search again from the start
+            ruleIndex = isSorted ? advanceFirstRuleNotBefore(zone->rules, ruleCount, ruleIndex, epoch) : findFirstRuleNotBefore(zone->rules, ruleCount, epoch);
         }
+
+        ZoneTransition zoneTransition = zoneTransitionAt(zone, ruleCount, ruleIndex);
+        if (zoneTransition.before == NULL) {
+            bool isInsideWindow = recurringTransition.before != NULL &&
+                                  recurringTransition.before->transition < epoch && epoch <= recurringTransition.after->transition;
+            if (!isInsideWindow) {
+                recurringTransition = findRecurringRuleTransition(epoch, zone, recurringRules);
+            }
+            zoneTransition = recurringTransition;
+        }
+        offsets[i] = resolveTransitionOffset(&zoneTransition, epoch, zone);
+    }
+}
+
+const char *resolveTimeZoneName(int64_t epochSeconds, const TimeZone *zone, ZoneTextStyle textStyle) {
+    if (isTimeZoneDaylightTime(epochSeconds, zone)) {
+        return (textStyle == ZONE_NAME_LONG) ? zone->names[ZONE_LONG_NAME_DTS_INDEX] : zone->names[ZONE_SHORT_NAME_DTS_INDEX];
     }
     return (textStyle == ZONE_NAME_LONG) ? zone->names[ZONE_LONG_NAME_STD_INDEX] : zone->names[ZONE_SHORT_NAME_STD_INDEX];
 }
 
+bool isTimeZoneDaylightTime(int64_t epochSeconds, const TimeZone *zone) {
+    TimeZoneRule recurringRules[2];
+    ZoneTransition zoneTransition = findZoneTransition(NULL, epochSeconds, zone, recurringRules);
+    if (zoneTransition.before == NULL) return false;
+    return (epochSeconds >= zoneTransition.after->transition) ? zoneTransition.after->isDaylightTime : zoneTransition.before->isDaylightTime;
+}
+
 ZoneTransition findZoneRuleTransition(int64_t epochSeconds, const TimeZone *zone) {
+    uint32_t ruleCount = resolveZoneRuleCount(zone);
+    uint32_t ruleIndex = (ruleCount > 1) ? findFirstRuleNotBefore(zone->rules, ruleCount, epochSeconds) : 0;
+    return zoneTransitionAt(zone, ruleCount, ruleIndex);
+}
+
+ZoneTransition findZoneRuleTransitionCached(ZoneTransitionCache *cache, int64_t epochSeconds, const TimeZone *zone) {
+    if (cache == NULL) return findZoneRuleTransition(epochSeconds, zone);
+
+    ZoneTransition zoneTransition;
+    if (!cache->isRecurring && findCachedZoneTransition(cache, epochSeconds, zone, &zoneTransition)) return zoneTransition;
+    zoneTransition = findZoneRuleTransition(epochSeconds, zone);
+    storeCachedZoneTransition(cache, &zoneTransition, zone, false);
+    return zoneTransition;
+}
+
+ZoneTransition findRecurringRuleTransition(int64_t epochSeconds, const TimeZone *zone, TimeZoneRule decodedRules[2]) {
     ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
-    if (zone->rules != NULL) {
-        uint32_t i = 0;
-        const TimeZoneRule *rule = NULL;
-        while ((rule = &zone->rules[i])->transition != 0) {
-            if (rule->transition >= epochSeconds && i > 0) {
-                zoneTransition.before = &zone->rules[i - 1];
-                zoneTransition.after = &zone->rules[i];
-                break;
-            }
-            i++;
+    const ZoneRecurringRule *recurringRule = zone->recurringRule;
+    if (recurringRule == NULL || !recurringRule->hasDaylightTime) return zoneTransition;
+
+    uint32_t ruleCount = resolveZoneRuleCount(zone);
+    if (ruleCount > 0 && epochSeconds <= zone->rules[ruleCount - 1].transition) return zoneTransition;
+
+    int64_t year = yearOfEpochDay(floorDiv(epochSeconds, SECONDS_PER_DAY));
+    TimeZoneRule yearRules[2];
+    buildRecurringRulesOfYear(recurringRule, year, yearRules);
+    if (epochSeconds <= yearRules[0].transition) {  // previous year transition is needed only before the first one
+        decodedRules[1] = yearRules[0];
+        buildRecurringRulesOfYear(recurringRule, year - 1, yearRules);
+        decodedRules[0] = yearRules[1];
+        if (epochSeconds <= yearRules[1].transition) {     // transition of previous year is after start of UTC year
+            decodedRules[0] = yearRules[0];
+            decodedRules[1] = yearRules[1];
+        }
+    } else if (epochSeconds <= yearRules[1].transition) {
+        decodedRules[0] = yearRules[0];
+        decodedRules[1] = yearRules[1];
+    } else {    // next year transition is needed only after the last one
+        decodedRules[0] = yearRules[1];
+        buildRecurringRulesOfYear(recurringRule, year + 1, yearRules);
+        decodedRules[1] = yearRules[0];
+        if (epochSeconds > yearRules[0].transition) {     // transition of next year is before end of UTC year
+            decodedRules[0] = yearRules[0];
+            decodedRules[1] = yearRules[1];
         }
     }
+    zoneTransition.before = &decodedRules[0];
+    zoneTransition.after = &decodedRules[1];
+    return zoneTransition;
+}
+
+bool parseZoneRecurringRule(const char *posixRule, ZoneRecurringRule *recurringRule) {
+    if (posixRule == NULL || recurringRule == NULL) return false;
+
+    const char *text = posixRule;
+    ZoneRecurringRule result = {0};
+    int32_t seconds;
+    if (!parseRecurringZoneName(&text) || !parseRecurringSeconds(&text, &seconds)) return false;
+    result.standardOffset = -seconds;   // POSIX offsets are positive to the west of Greenwich
+    result.daylightOffset = result.standardOffset;
+
+    if (*text != '\0') {
+        if (!parseRecurringZoneName(&text)) return false;
+        result.hasDaylightTime = true;
+        result.daylightOffset = result.standardOffset + SECONDS_PER_HOUR;
+        if (*text != ',' && *text != '\0') {
+            if (!parseRecurringSeconds(&text, &seconds)) return false;
+            result.daylightOffset = -seconds;
+        }
+
+        text = (*text == '\0') ? RECURRING_DEFAULT_DATES : text;
+        if (*text++ != ',' || !parseRecurringDate(&text, &result.daylightStart)) return false;
+        if (*text++ != ',' || !parseRecurringDate(&text, &result.daylightEnd)) return false;
+    }
+
+    if (*text != '\0') return false;
+    *recurringRule = result;
+    return true;
+}
+
+bool packTimeZoneRules(const TimeZoneRule *rules, uint16_t ruleCount, CompactTimeZoneRules *compactRules,
+                       uint32_t *transitionDeltas, uint8_t *offsetTypeIndexes, ZoneOffsetType *offsetTypes, uint8_t offsetTypesCapacity) {
+    if (rules == NULL || compactRules == NULL || ruleCount == 0) return false;
+
+    uint8_t offsetTypeCount = 0;
+    for (uint16_t i = 0; i < ruleCount; i++) {
+        int64_t delta = rules[i].transition - rules[0].transition;
+        if (delta < 0 || delta > UINT32_MAX) return false;  // unsorted or too wide rule range
+        transitionDeltas[i] = (uint32_t) delta;
+        if (!findOffsetTypeIndex(&rules[i], offsetTypes, &offsetTypeCount, offsetTypesCapacity, &offsetTypeIndexes[i])) return false;
+    }
+
+    compactRules->baseTransition = rules[0].transition;
+    compactRules->transitionDeltas = transitionDeltas;
+    compactRules->offsetTypeIndexes = offsetTypeIndexes;
+    compactRules->offsetTypes = offsetTypes;
+    compactRules->ruleCount = ruleCount;
+    compactRules->offsetTypeCount = offsetTypeCount;
+    return true;
+}
+
+ZoneTransition findCompactZoneRuleTransition(int64_t epochSeconds, const CompactTimeZoneRules *compactRules, TimeZoneRule decodedRules[2]) {
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    if (compactRules == NULL || compactRules->ruleCount <= 1) return zoneTransition;
+
+    uint32_t ruleIndex = 0;
+    if (epochSeconds > compactRules->baseTransition) {
+        int64_t delta = epochSeconds - compactRules->baseTransition;
+        ruleIndex = (delta > UINT32_MAX) ? compactRules->ruleCount : findFirstDeltaNotBefore(compactRules, (uint32_t) delta);
+    }
+
+    if (ruleIndex < compactRules->ruleCount) {
+        ruleIndex = (ruleIndex > 0) ? ruleIndex : 1;
+        decodeCompactRule(compactRules, ruleIndex - 1, &decodedRules[0]);
+        decodeCompactRule(compactRules, ruleIndex, &decodedRules[1]);
+        zoneTransition.before = &decodedRules[0];
+        zoneTransition.after = &decodedRules[1];
+    }
+    return zoneTransition;
+}
+
+int32_t resolveCompactTimeZoneOffset(int64_t epochSeconds, const CompactTimeZoneRules *compactRules, const TimeZone *zone) {
+    TimeZoneRule decodedRules[2];
+    ZoneTransition zoneTransition = findCompactZoneRuleTransition(epochSeconds, compactRules, decodedRules);
+    if (zoneTransition.before == NULL) {
+        zoneTransition = findRecurringRuleTransition(epochSeconds, zone, decodedRules);
+    }
+    return resolveTransitionOffset(&zoneTransition, epochSeconds, zone);
+}
+
+bool unpackTimeZoneRules(const CompactTimeZoneRules *compactRules, TimeZoneRule *rules, uint16_t rulesCapacity) {
+    if (compactRules == NULL || rules == NULL || compactRules->ruleCount > rulesCapacity) return false;
+    for (uint16_t i = 0; i < compactRules->ruleCount; i++) {
+        if (compactRules->offsetTypeIndexes[i] >= compactRules->offsetTypeCount) return false;
+        decodeCompactRule(compactRules, i, &rules[i]);
+    }
+    return true;
+}
+
+bool packVarintTimeZoneRules(const TimeZoneRule *rules, uint16_t ruleCount, VarintTimeZoneRules *varintRules,
+                             uint8_t *data, uint32_t dataCapacity, ZoneOffsetType *offsetTypes, uint8_t offsetTypesCapacity) {
+    if (rules == NULL || varintRules == NULL || ruleCount == 0) return false;
+
+    uint8_t offsetTypeCount = 0;
+    uint8_t typeIndex;
+    for (uint16_t i = 0; i < ruleCount; i++) {     // palette first, so index width is known before encoding
+        if (!findOffsetTypeIndex(&rules[i], offsetTypes, &offsetTypeCount, offsetTypesCapacity, &typeIndex)) return false;
+    }
+    uint8_t offsetIndexBits = 0;
+    while ((1U << offsetIndexBits) < offsetTypeCount) {
+        offsetIndexBits++;
+    }
+
+    uint32_t dataLength = 0;
+    int64_t previousTransition = 0;
+    for (uint16_t i = 0; i < ruleCount; i++) {
+        int64_t delta = rules[i].transition - previousTransition;
+        bool isMinutes = (delta % SECONDS_PER_MINUTE) == 0;
+        delta = isMinutes ? delta / SECONDS_PER_MINUTE : delta;
+        uint64_t zigzag = ((uint64_t) delta << 1) ^ (uint64_t) (delta >> 63);
+        if ((zigzag >> (62 - offsetIndexBits)) != 0) return false;     // flag and index bits should fit in 64 bits
+
+        findOffsetTypeIndex(&rules[i], offsetTypes, &offsetTypeCount, offsetTypesCapacity, &typeIndex);
+        uint64_t value = (((zigzag << 1) | isMinutes) << offsetIndexBits) | typeIndex;
+        uint8_t encoded[VARINT_RULE_MAX_LENGTH];
+        uint32_t length = writeVarint(value, encoded);
+        if (length > dataCapacity - dataLength) return false;
+        memcpy(data + dataLength, encoded, length);
+        dataLength += length;
+        previousTransition = rules[i].transition;
+    }
+
+    varintRules->data = data;
+    varintRules->offsetTypes = offsetTypes;
+    varintRules->dataLength = dataLength;
+    varintRules->ruleCount = ruleCount;
+    varintRules->offsetTypeCount = offsetTypeCount;
+    varintRules->offsetIndexBits = offsetIndexBits;
+    return true;
+}
+
+bool unpackVarintTimeZoneRules(const VarintTimeZoneRules *varintRules, TimeZoneRule *rules, uint16_t rulesCapacity) {
+    if (varintRules == NULL || rules == NULL || varintRules->ruleCount > rulesCapacity) return false;
+
+    uint32_t position = 0;
+    int64_t transition = 0;
+    uint64_t indexMask = ((uint64_t) 1 << varintRules->offsetIndexBits) - 1;
+    for (uint16_t i = 0; i < varintRules->ruleCount; i++) {
+        uint64_t value;
+        uint32_t length = readVarint(varintRules->data + position, varintRules->dataLength - position, &value);
+        uint64_t typeIndex = value & indexMask;
+        if (length == 0 || typeIndex >= varintRules->offsetTypeCount) return false;
+        position += length;
+
+        value >>= varintRules->offsetIndexBits;
+        uint64_t zigzag = value >> 1;
+        int64_t delta = (int64_t) (zigzag >> 1) ^ -(int64_t) (zigzag & 1);
+        transition += (value & 1) ? delta * SECONDS_PER_MINUTE : delta;
+        rules[i].transition = transition;
+        rules[i].gmtOffset = varintRules->offsetTypes[typeIndex].gmtOffset;
+        rules[i].isDaylightTime = varintRules->offsetTypes[typeIndex].isDaylightTime;
+    }
+    return true;
+}
+
+bool buildZoneTransitionIndex(const TimeZone *zone, ZoneTransitionBlock *blocks, uint16_t capacity, ZoneTransitionIndex *index) {
+    if (zone == NULL || index == NULL) return false;
+    uint32_t ruleCount = resolveZoneRuleCount(zone);
+    uint32_t blockCount = ZONE_TRANSITION_BLOCK_COUNT(ruleCount);
+    if (blockCount > capacity || (blockCount > 0 && blocks == NULL)) return false;
+
+    uint32_t ruleIndex = 0;
+    fillTransitionBlocks(zone->rules, ruleCount, blocks, blockCount, 0, &ruleIndex);
+    index->rules = zone->rules;
+    index->blocks = blocks;
+    index->ruleCount = ruleCount;
+    index->blockCount = blockCount;
+    index->kernel = detectZoneSearchKernel();
+    return true;
+}
+
+ZoneSearchKernel detectZoneSearchKernel() {
+#ifdef ZONE_SEARCH_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return ZONE_SEARCH_AVX2;
+    if (__builtin_cpu_supports("sse4.2")) return ZONE_SEARCH_SSE42;
+#endif
+    return ZONE_SEARCH_SCALAR;
+}
+
+ZoneTransition findIndexedZoneRuleTransition(int64_t epochSeconds, const ZoneTransitionIndex *index) {
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    if (index == NULL || index->ruleCount <= 1) return zoneTransition;
+
+    uint32_t ruleIndex;
+    switch (index->kernel) {
+#ifdef ZONE_SEARCH_X86_KERNELS
+        case ZONE_SEARCH_AVX2:
+            ruleIndex = searchTransitionBlocksAvx2(index, epochSeconds);
+            break;
+        case ZONE_SEARCH_SSE42:
+            ruleIndex = searchTransitionBlocksSse42(index, epochSeconds);
+            break;
+#endif
+        default:
+            ruleIndex = searchTransitionBlocks(index, epochSeconds);
+    }
+
+    if (ruleIndex < index->ruleCount) {
+        ruleIndex = (ruleIndex > 0) ? ruleIndex : 1;
+        zoneTransition.before = &index->rules[ruleIndex - 1];
+        zoneTransition.after = &index->rules[ruleIndex];
+    }
     return zoneTransition;
 }
 
+int32_t resolveIndexedTimeZoneOffset(int64_t epochSeconds, const ZoneTransitionIndex *index, const TimeZone *zone) {
+    TimeZoneRule recurringRules[2];
+    ZoneTransition zoneTransition = findIndexedZoneRuleTransition(epochSeconds, index);
+    if (zoneTransition.before == NULL) {
+        zoneTransition = findRecurringRuleTransition(epochSeconds, zone, recurringRules);
+    }
+    return resolveTransitionOffset(&zoneTransition, epochSeconds, zone);
+}
+
+bool buildLocalZoneRules(const TimeZone *zone, LocalZoneTransition *transitions, uint16_t capacity, LocalZoneRules *localRules) {
+    if (zone == NULL || transitions == NULL || localRules == NULL) return false;
+    uint32_t ruleCount = resolveZoneRuleCount(zone);
+    uint32_t transitionCount = ruleCount > 1 ? ruleCount - 1 : 0;
+    if (transitionCount > capacity) return false;
+
+    for (uint32_t i = 0; i < transitionCount; i++) {
+        transitions[i] = localTransitionOf(zone->rules, i + 1);
+    }
+    localRules->transitions = transitions;
+    localRules->transitionCount = transitionCount;
+    return true;
+}
+
+LocalZoneOffsets resolveLocalZoneOffsets(int64_t localEpochSeconds, const LocalZoneRules *localRules, const TimeZone *zone) {
+    LocalZoneOffsets localOffsets = {.offsets = {zone->utcOffset, zone->utcOffset}, .offsetCount = 1, .transition = 0};
+    if (findLocalZoneOffsets(localEpochSeconds, localRules, zone->rules, resolveZoneRuleCount(zone), &localOffsets)) {
+        return localOffsets;
+    }
+
+    const ZoneRecurringRule *recurringRule = zone->recurringRule;   // after the last zone rule transition
+    if (recurringRule != NULL && recurringRule->hasDaylightTime) {
+        TimeZoneRule yearRules[RECURRING_YEAR_TRANSITIONS];
+        buildRecurringYearRules(recurringRule, yearOfEpochDay(floorDiv(localEpochSeconds, SECONDS_PER_DAY)), yearRules);
+        findLocalZoneOffsets(localEpochSeconds, NULL, yearRules, RECURRING_YEAR_TRANSITIONS, &localOffsets);
+    }
+    return localOffsets;
+}
+
+bool initZoneOffsetIndex(ZoneOffsetIndex *index, ZoneOffsetEntry *entries, uint16_t capacity) {
+    if (index == NULL || entries == NULL || capacity < ZONE_LIST_LENGTH) return false;
+    index->entries = entries;
+    index->entryCount = 0;
+    index->validFrom = INT64_MAX;
+    index->validUntil = INT64_MIN;
+    return true;
+}
+
+uint16_t findZonesWithOffset(ZoneOffsetIndex *index, int64_t epochSeconds, int32_t offset, const ZoneOffsetEntry **zoneEntries) {
+    updateZoneOffsetIndex(index, epochSeconds);
+    uint16_t firstIndex = findFirstEntryNotBefore(index, offset);
+    uint16_t endIndex = findFirstEntryNotBefore(index, (int64_t) offset + 1);
+    *zoneEntries = &index->entries[firstIndex];
+    return endIndex - firstIndex;
+}
+
+uint16_t findZonesCrossingLocalTime(ZoneOffsetIndex *index, int64_t fromEpochSeconds, int64_t toEpochSeconds, int32_t secondOfDay,
+                                    uint16_t *zoneIndexes, uint16_t capacity) {
+    uint16_t zoneCount = 0;
+    uint32_t foundZones[ZONE_LIST_LENGTH / 32 + 1];     // bit for each ZONE_LIST index, zone can pass local time in several snapshots
+    memset(foundZones, 0, sizeof(foundZones));
+    int64_t segmentStart = fromEpochSeconds;
+    while (segmentStart < toEpochSeconds) {     // offsets are constant inside each snapshot
+        updateZoneOffsetIndex(index, segmentStart);
+        int64_t segmentEnd = (index->validUntil < toEpochSeconds - 1) ? index->validUntil + 1 : toEpochSeconds;
+        if (index->entryCount == 0) break;
+
+        // local time 'day * SECONDS_PER_DAY + secondOfDay' is passed at 'epoch' when offset is in range (localTime - segmentEnd, localTime - segmentStart]
+        int32_t minOffset = index->entries[0].offset;
+        int32_t maxOffset = index->entries[index->entryCount - 1].offset;
+        int64_t firstDay = floorDiv(segmentStart + minOffset - secondOfDay, SECONDS_PER_DAY);
+        int64_t lastDay = floorDiv(segmentEnd - 1 + maxOffset - secondOfDay, SECONDS_PER_DAY);
+        for (int64_t day = firstDay; day <= lastDay && zoneCount < capacity; day++) {
+            int64_t localTime = day * SECONDS_PER_DAY + secondOfDay;
+            uint16_t firstIndex = findFirstEntryNotBefore(index, localTime - segmentEnd + 1);
+            uint16_t endIndex = findFirstEntryNotBefore(index, localTime - segmentStart + 1);
+            for (uint16_t i = firstIndex; i < endIndex && zoneCount < capacity; i++) {
+                uint16_t zoneIndex = index->entries[i].zoneIndex;
+                uint32_t zoneBit = 1U << (zoneIndex % 32);
+                if ((foundZones[zoneIndex / 32] & zoneBit) == 0) {
+                    foundZones[zoneIndex / 32] |= zoneBit;
+                    zoneIndexes[zoneCount++] = zoneIndex;
+                }
+            }
+        }
+        segmentStart = segmentEnd;
+    }
+    return zoneCount;
+}
+
 bool isTransitionGap(ZoneTransition *transition, int64_t epochSeconds) {
-    uint32_t secondsBefore = transition->before->transition;
-    uint32_t offsetAfter = transition->after->gmtOffset;
+    int64_t secondsBefore = transition->before->transition;
+    int64_t offsetAfter = transition->after->gmtOffset;
     return (epochSeconds >= secondsBefore) && (epochSeconds < (secondsBefore + offsetAfter));
 }
 
-bool isTimeZoneEquals(const TimeZone *timeZone, const TimeZone *other) {
-    return strcmp(timeZone->id, other->id) == 0 && timeZone->utcOffset == other->utcOffset;
+const TimeZone *getCanonicalTimeZone(const TimeZone *zone) {
+    if (zone == NULL || zone->id == NULL) return zone;
+    int32_t zoneIndex = findCanonicalZoneIndex(zone);
+    return zoneIndex == ZONE_NOT_FOUND ? zone : zoneOfIndex(zoneIndex);
+}
+
+ZoneHandle zoneHandleOf(const TimeZone *zone) {
+    if (zone == NULL || zone->id == NULL) return ZONE_HANDLE_NONE;
+    uintptr_t zoneAddress = (uintptr_t) zone;
+    if (zoneAddress >= (uintptr_t) ZONE_LIST && zoneAddress < (uintptr_t) (ZONE_LIST + ZONE_LIST_LENGTH)) {
+        return (ZoneHandle) (zone - ZONE_LIST);
+    }
+
+    int32_t zoneIndex = findZoneIndexById(zone->id, strlen(zone->id));
+    if (zoneIndex != ZONE_NOT_FOUND && isSameZoneData(zoneOfIndex(zoneIndex), zone)) {   // copy of ZONE_LIST entry
+        return (ZoneHandle) zoneIndex;
+    }
+
+    if (zone->rules == NULL && zone->recurringRule == NULL) {
+        if (strcmp(zone->id, UTC.id) == 0) return ZONE_HANDLE_FIXED_UTC;
+        if (strcmp(zone->id, GMT.id) == 0) return ZONE_HANDLE_FIXED_GMT;
+    }
+    return ZONE_HANDLE_EXTERNAL;
+}
+
+const TimeZone *resolveZoneHandle(ZoneHandle handle, const TimeZone *externalZone, int32_t fixedOffset, TimeZone *fixedZone) {
+    if (handle < ZONE_LIST_LENGTH) {
+        return zoneOfIndex(handle);
+    }
+    if (handle == ZONE_HANDLE_EXTERNAL) {
+        return externalZone;
+    }
+    if ((handle == ZONE_HANDLE_FIXED_UTC || handle == ZONE_HANDLE_FIXED_GMT) && fixedZone != NULL) {
+        *fixedZone = (handle == ZONE_HANDLE_FIXED_UTC) ? UTC : GMT;
+        fixedZone->utcOffset = fixedOffset;
+        return fixedZone;
+    }
+    return NULL;
 }
 
-static int32_t findZoneIndexById(const char *id) {  // binary search
+bool isZoneHandleEquals(ZoneHandle handle, const TimeZone *externalZone, ZoneHandle other, const TimeZone *otherExternalZone) {
+    if (handle == other && (handle != ZONE_HANDLE_EXTERNAL || externalZone == otherExternalZone)) return true;
     #ifdef ENABLE_TIME_ZONE_SUPPORT
-    int32_t leftIndex = 0;
-    int32_t rightIndex = ARRAY_SIZE(ZONE_LIST) - 1;
-    while (leftIndex <= rightIndex) {
-        int32_t middleIndex = leftIndex + (rightIndex - leftIndex) / 2;
+    if (handle < ZONE_LIST_LENGTH && other < ZONE_LIST_LENGTH) {
+        return ZONE_LINK_INDEXES[handle] == ZONE_LINK_INDEXES[other];
+    }
+    #endif
+
+    const TimeZone *zone = resolveZoneHandle(handle, externalZone, 0, NULL);     // fixed offset zones are equal only to themselves
+    const TimeZone *otherZone = resolveZoneHandle(other, otherExternalZone, 0, NULL);
+    return zone != NULL && otherZone != NULL && isTimeZoneEquals(zone, otherZone);
+}
+
+bool isTimeZoneEquals(const TimeZone *timeZone, const TimeZone *other) {
+    if (timeZone->utcOffset != other->utcOffset) return false;
+    if (timeZone->id == other->id) return true;     // copies of the same zone
 
-        int32_t res = -1000;   // some random value assigned because if res is already 0 then it will always return 0
-        if (strcmp(id, ZONE_LIST[middleIndex].id) == 0)
-            res = 0;
+    int32_t zoneIndex = findCanonicalZoneIndex(timeZone);
+    int32_t otherZoneIndex = findCanonicalZoneIndex(other);
+    if (zoneIndex != ZONE_NOT_FOUND && otherZoneIndex != ZONE_NOT_FOUND) {
+        return zoneIndex == otherZoneIndex;
+    }
+    return strcmp(timeZone->id, other->id) == 0;
+}
 
-        if (res == 0) { // Check if id is present at mid
-            return middleIndex;
+#ifdef ENABLE_TIME_ZONE_SUBSET
+static int32_t findZoneIndexById(const char *id, uint32_t length) {  // hash is generated for full list only, binary search in subset
+    int32_t low = 0;
+    int32_t high = ZONE_LIST_LENGTH - 1;
+    while (low <= high) {
+        int32_t middle = (low + high) / 2;
+        const char *zoneId = ZONE_LIST[middle].id;
+        int32_t result = strncmp(zoneId, id, length);
+        if (result == 0 && zoneId[length] != '\0') {   // provided id is a prefix of zone id
+            result = 1;
         }
 
-        if (strcmp(id, ZONE_LIST[middleIndex].id) > 0) {    // If id greater, ignore leftIndex half
-            leftIndex = middleIndex + 1;
+        if (result < 0) {
+            low = middle + 1;
+        } else if (result > 0) {
+            high = middle - 1;
         } else {
-            rightIndex = middleIndex - 1;  // If x is smaller, ignore rightIndex half
+            return middle;
         }
     }
+    return ZONE_NOT_FOUND;
+}
+#else
+static int32_t findZoneIndexById(const char *id, uint32_t length) {  // minimal perfect hash, single probe
+    #ifdef ENABLE_TIME_ZONE_SUPPORT
+    uint32_t hash = hashZoneId(id, length);
+    uint16_t zoneIndex = ZONE_ID_HASH_SLOTS[zoneIdHashSlot(hash, ZONE_ID_HASH_SEEDS[zoneIdHashBucket(hash)])];
+    if (zoneIndex < ZONE_LIST_LENGTH) {
+        const char *zoneId = ZONE_LIST[zoneIndex].id;
+        if (strlen(zoneId) == length && memcmp(zoneId, id, length) == 0) {
+            return zoneIndex;
+        }
+    }
+    #else
+    (void) id;
+    (void) length;
+    #endif
+    return ZONE_NOT_FOUND;
+}
+#endif
+
+static const TimeZone *zoneOfIndex(uint16_t zoneIndex) {   // compressed and compact rules are decoded on first access
+    #if defined(ENABLE_TIME_ZONE_COMPRESSED_RULES) || defined(ENABLE_TIME_ZONE_COMPACT_RULES)
+    return getDecodedTimeZone(zoneIndex);
+    #else
+    return &ZONE_LIST[zoneIndex];
     #endif
+}
+
+static int32_t findCanonicalZoneIndex(const TimeZone *zone) {
+    #ifdef ENABLE_TIME_ZONE_SUPPORT
+    int32_t zoneIndex = findZoneIndexById(zone->id, strlen(zone->id));
+    return zoneIndex == ZONE_NOT_FOUND ? ZONE_NOT_FOUND : ZONE_LINK_INDEXES[zoneIndex];
+    #else
+    (void) zone;
     return ZONE_NOT_FOUND;
-}
\ No newline at end of file
+    #endif
+}
+
+static bool isSameZoneData(const TimeZone *zone, const TimeZone *other) {
+    return zone->utcOffset == other->utcOffset && zone->names == other->names && zone->rules == other->rules &&
+           zone->recurringRule == other->recurringRule;
+}
+
+static int32_t resolveTransitionOffset(ZoneTransition *transition, int64_t epochSeconds, const TimeZone *zone) {
+    if (transition->after != NULL && transition->before != NULL) {     // 'after' offset applies from its transition second
+        return (epochSeconds >= transition->after->transition) ? transition->after->gmtOffset : transition->before->gmtOffset;
+    }
+    return zone->utcOffset;
+}
+
+static ZoneTransition findZoneTransition(ZoneTransitionCache *cache, int64_t epochSeconds, const TimeZone *zone, TimeZoneRule recurringRules[2]) {
+    ZoneTransition zoneTransition;
+    if (cache != NULL && findCachedZoneTransition(cache, epochSeconds, zone, &zoneTransition)) return zoneTransition;
+
+    zoneTransition = findZoneRuleTransition(epochSeconds, zone);
+    bool isRecurring = (zoneTransition.before == NULL);
+    if (isRecurring) {
+        zoneTransition = findRecurringRuleTransition(epochSeconds, zone, recurringRules);
+    }
+    if (cache != NULL) {
+        storeCachedZoneTransition(cache, &zoneTransition, zone, isRecurring);
+    }
+    return zoneTransition;
+}
+
+static bool findCachedZoneTransition(ZoneTransitionCache *cache, int64_t epochSeconds, const TimeZone *zone, ZoneTransition *zoneTransition) {
+    bool isSameZone = cache->hasTransition && cache->rules == zone->rules && cache->recurringRule == zone->recurringRule;
+    if (!isSameZone || epochSeconds <= cache->validFrom || epochSeconds > cache->after.transition) return false;
+    cache->hits++;
+    zoneTransition->before = &cache->before;
+    zoneTransition->after = &cache->after;
+    return true;
+}
+
+static void storeCachedZoneTransition(ZoneTransitionCache *cache, const ZoneTransition *zoneTransition, const TimeZone *zone, bool isRecurring) {
+    cache->misses++;
+    if (zoneTransition->before == NULL) return;     // previous window is kept
+
+    int64_t validFrom = zoneTransition->before->transition;
+    if (isRecurring) {      // recurring rule applies only after the last zone rule
+        uint32_t ruleCount = resolveZoneRuleCount(zone);
+        int64_t lastTransition = (ruleCount > 0) ? zone->rules[ruleCount - 1].transition : INT64_MIN;
+        validFrom = (validFrom > lastTransition) ? validFrom : lastTransition;
+    } else if (zoneTransition->before == zone->rules) {
+        validFrom = INT64_MIN;      // first pair also covers all seconds before it
+    }
+    cache->rules = zone->rules;
+    cache->recurringRule = zone->recurringRule;
+    cache->before = *zoneTransition->before;
+    cache->after = *zoneTransition->after;
+    cache->validFrom = validFrom;
+    cache->hasTransition = true;
+    cache->isRecurring = isRecurring;
+}
+
+static const ZoneYearEntry *findZoneYearEntry(const ZoneYearCache *cache, int64_t epochSeconds) {
+    for (uint8_t i = 0; i < cache->entryCount; i++) {
+        const ZoneYearEntry *entry = &cache->entries[i];
+        if (entry->firstEpochSecond <= epochSeconds && epochSeconds <= entry->lastEpochSecond) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/* Splits year of epoch seconds into segments with the same rules pair, each pair applies up to its 'after' transition*/
+static const ZoneYearEntry *fillZoneYearEntry(ZoneYearCache *cache, int64_t epochSeconds, const TimeZone *zone) {
+    ZoneYearEntry *entry = &cache->entries[cache->nextEntryIndex];
+    cache->nextEntryIndex = (cache->nextEntryIndex + 1) % ZONE_YEAR_CACHE_SIZE;
+    cache->entryCount += (cache->entryCount < ZONE_YEAR_CACHE_SIZE);
+
+    int64_t year = yearOfEpochDay(floorDiv(epochSeconds, SECONDS_PER_DAY));
+    entry->firstEpochSecond = epochDayOfYearStart(year) * SECONDS_PER_DAY;
+    entry->lastEpochSecond = epochDayOfYearStart(year + 1) * SECONDS_PER_DAY - 1;
+    entry->segmentCount = 0;
+
+    int64_t segmentStart = entry->firstEpochSecond;
+    for (uint8_t i = 0; i < ZONE_YEAR_MAX_SEGMENTS; i++) {
+        TimeZoneRule recurringRules[2];
+        ZoneTransition zoneTransition = findZoneTransition(NULL, segmentStart, zone, recurringRules);
+        ZoneYearSegment *segment = &entry->segments[i];
+        segment->hasTransition = (zoneTransition.before != NULL);
+        if (segment->hasTransition) {
+            segment->before = *zoneTransition.before;
+            segment->after = *zoneTransition.after;
+        }
+        segment->lastEpochSecond = segment->hasTransition ? segment->after.transition : INT64_MAX;
+        if (segment->lastEpochSecond >= entry->lastEpochSecond) {
+            entry->segmentCount = i + 1;
+            break;
+        }
+        segmentStart = segment->lastEpochSecond + 1;
+    }
+    return entry;
+}
+
+static void updateZoneOffsetIndex(ZoneOffsetIndex *index, int64_t epochSeconds) {
+    if (index->validFrom <= epochSeconds && epochSeconds <= index->validUntil) return;
+
+    int64_t nextChange = INT64_MAX;
+    for (uint16_t i = 0; i < ZONE_LIST_LENGTH; i++) {
+        index->entries[i].offset = resolveTimeZoneOffset(epochSeconds, zoneOfIndex(i));
+        index->entries[i].zoneIndex = i;
+        int64_t zoneChange = findNextOffsetChange(epochSeconds, zoneOfIndex(i));
+        nextChange = (zoneChange < nextChange) ? zoneChange : nextChange;
+    }
+    qsort(index->entries, ZONE_LIST_LENGTH, sizeof(ZoneOffsetEntry), compareZoneOffsetEntries);
+    index->entryCount = ZONE_LIST_LENGTH;
+    index->validFrom = epochSeconds;
+    index->validUntil = nextChange - 1;
+}
+
+/* Offset changes at the 'after' transition of rules pair, same as resolveTransitionOffset()*/
+static int64_t findNextOffsetChange(int64_t epochSeconds, const TimeZone *zone) {
+    TimeZoneRule recurringRules[2];
+    ZoneTransition zoneTransition = findZoneTransition(NULL, epochSeconds, zone, recurringRules);
+    while (zoneTransition.before != NULL && zoneTransition.after->transition <= epochSeconds) {    // pair ends at epoch seconds
+        zoneTransition = findZoneTransition(NULL, ++epochSeconds, zone, recurringRules);
+    }
+    return (zoneTransition.before != NULL) ? zoneTransition.after->transition : INT64_MAX;
+}
+
+static int compareZoneOffsetEntries(const void *entry, const void *other) {
+    const ZoneOffsetEntry *zoneEntry = entry;
+    const ZoneOffsetEntry *otherEntry = other;
+    if (zoneEntry->offset != otherEntry->offset) {
+        return (zoneEntry->offset < otherEntry->offset) ? -1 : 1;
+    }
+    return (int) zoneEntry->zoneIndex - (int) otherEntry->zoneIndex;
+}
+
+static uint16_t findFirstEntryNotBefore(const ZoneOffsetIndex *index, int64_t offset) {  // binary search, lower bound
+    uint16_t leftIndex = 0;
+    uint16_t rightIndex = index->entryCount;
+    while (leftIndex < rightIndex) {
+        uint16_t middleIndex = leftIndex + (rightIndex - leftIndex) / 2;
+        if (index->entries[middleIndex].offset < offset) {
+            leftIndex = middleIndex + 1;
+        } else {
+            rightIndex = middleIndex;
+        }
+    }
+    return leftIndex;
+}
+
+static void buildRecurringRulesOfYear(const ZoneRecurringRule *recurringRule, int64_t year, TimeZoneRule yearRules[2]) {
+    TimeZoneRule daylightStart = {
+            .gmtOffset = recurringRule->daylightOffset,
+            .isDaylightTime = true,
+            .transition = recurringDateToEpochSecond(&recurringRule->daylightStart, year, recurringRule->standardOffset)
+    };
+    TimeZoneRule daylightEnd = {
+            .gmtOffset = recurringRule->standardOffset,
+            .isDaylightTime = false,
+            .transition = recurringDateToEpochSecond(&recurringRule->daylightEnd, year, recurringRule->daylightOffset)
+    };
+    bool isEndFirst = daylightEnd.transition < daylightStart.transition;  // southern hemisphere rules end daylight time first
+    yearRules[0] = isEndFirst ? daylightEnd : daylightStart;
+    yearRules[1] = isEndFirst ? daylightStart : daylightEnd;
+}
+
+static void buildRecurringYearRules(const ZoneRecurringRule *recurringRule, int64_t year, TimeZoneRule yearRules[RECURRING_YEAR_TRANSITIONS]) {
+    for (uint32_t i = 0; i < RECURRING_YEAR_TRANSITIONS; i += 2) {
+        buildRecurringRulesOfYear(recurringRule, year - 1 + i / 2, &yearRules[i]);
+    }
+
+    for (uint32_t i = 1; i < RECURRING_YEAR_TRANSITIONS; i++) {    // transitions with hours past the year end
+        TimeZoneRule rule = yearRules[i];
+        uint32_t j = i;
+        for (; j > 0 && yearRules[j - 1].transition > rule.transition; j--) {
+            yearRules[j] = yearRules[j - 1];
+        }
+        yearRules[j] = rule;
+    }
+}
+
+static LocalZoneTransition localTransitionOf(const TimeZoneRule *rules, uint32_t ruleIndex) {    // transition to rules[ruleIndex]
+    int32_t offsetBefore = rules[ruleIndex - 1].gmtOffset;
+    int32_t offsetAfter = rules[ruleIndex].gmtOffset;
+    int64_t localStart = rules[ruleIndex].transition + (offsetBefore < offsetAfter ? offsetBefore : offsetAfter);
+    return (LocalZoneTransition) {.localStart = localStart, .offsetBefore = offsetBefore, .offsetAfter = offsetAfter};
+}
+
+/* Binary search for the last local transition not after provided local seconds, precomputed transitions are used if provided.
+ * Returns false when local seconds are after the last transition, so offset should be resolved from the following rules*/
+static bool findLocalZoneOffsets(int64_t localEpochSeconds, const LocalZoneRules *localRules, const TimeZoneRule *rules, uint32_t ruleCount, LocalZoneOffsets *localOffsets) {
+    uint32_t transitionCount = (localRules != NULL) ? localRules->transitionCount : (ruleCount > 1 ? ruleCount - 1 : 0);
+    if (transitionCount == 0) return false;
+
+    uint32_t low = 0;
+    uint32_t high = transitionCount;
+    while (low < high) {    // first transition with local start after local seconds
+        uint32_t middle = low + (high - low) / 2;
+        int64_t localStart = (localRules != NULL) ? localRules->transitions[middle].localStart : localTransitionOf(rules, middle + 1).localStart;
+        if (localStart <= localEpochSeconds) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if (low == 0) {     // before the first transition
+        LocalZoneTransition first = (localRules != NULL) ? localRules->transitions[0] : localTransitionOf(rules, 1);
+        localOffsets->offsets[0] = first.offsetBefore;
+        localOffsets->offsets[1] = first.offsetBefore;
+        localOffsets->offsetCount = 1;
+        return true;
+    }
+
+    LocalZoneTransition transition = (localRules != NULL) ? localRules->transitions[low - 1] : localTransitionOf(rules, low);
+    int32_t offsetDifference = transition.offsetAfter - transition.offsetBefore;
+    int64_t localEnd = transition.localStart + (offsetDifference < 0 ? -offsetDifference : offsetDifference);
+    if (localEpochSeconds < localEnd) {     // gap when offset increases, overlap when decreases
+        localOffsets->offsets[0] = transition.offsetBefore;
+        localOffsets->offsets[1] = transition.offsetAfter;
+        localOffsets->offsetCount = (offsetDifference > 0) ? 0 : 2;
+        localOffsets->transition = transition.localStart - (offsetDifference > 0 ? transition.offsetBefore : transition.offsetAfter);
+        return true;
+    }
+    if (low == transitionCount) return false;
+
+    localOffsets->offsets[0] = transition.offsetAfter;
+    localOffsets->offsets[1] = transition.offsetAfter;
+    localOffsets->offsetCount = 1;
+    return true;
+}
+
+static uint32_t resolveZoneRuleCount(const TimeZone *zone) {
+    if (zone->rules == NULL) return 0;
+    if (zone->ruleCount > 0) return zone->ruleCount;
+
+    uint32_t ruleCount = 0;     // user defined zone without stored length, count until terminating entry
+    while (zone->rules[ruleCount].transition != 0) {
+        ruleCount++;
+    }
+    return ruleCount;
+}
+
+static uint32_t findFirstRuleNotBefore(const TimeZoneRule *rules, uint32_t ruleCount, int64_t epochSeconds) {  // binary search, lower bound
+    uint32_t leftIndex = 0;
+    uint32_t rightIndex = ruleCount;
+    while (leftIndex < rightIndex) {
+        uint32_t middleIndex = leftIndex + (rightIndex - leftIndex) / 2;
+        if (rules[middleIndex].transition < epochSeconds) {
+            leftIndex = middleIndex + 1;
+        } else {
+            rightIndex = middleIndex;
+        }
+    }
+    return leftIndex;
+}
+
+/* Merge walk for sorted epoch seconds: all rules before provided index are before epoch seconds.
+ * Galloping steps keep the cost logarithmic when epoch seconds skip many rules*/
+static uint32_t advanceFirstRuleNotBefore(const TimeZoneRule *rules, uint32_t ruleCount, uint32_t ruleIndex, int64_t epochSeconds) {
+    uint32_t startIndex = ruleIndex;
+    uint32_t step = 1;
+    while (ruleIndex < ruleCount && rules[ruleIndex].transition < epochSeconds) {
+        startIndex = ruleIndex + 1;
+        ruleIndex += step;
+        step *= 2;
+    }
+    uint32_t endIndex = (ruleIndex < ruleCount) ? ruleIndex : ruleCount;
+    return startIndex + findFirstRuleNotBefore(rules + startIndex, endIndex - startIndex, epochSeconds);
+}
+
+static ZoneTransition zoneTransitionAt(const TimeZone *zone, uint32_t ruleCount, uint32_t ruleIndex) {
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    if (ruleCount > 1 && ruleIndex < ruleCount) {
+        ruleIndex = (ruleIndex > 0) ? ruleIndex : 1;    // transition before first rule resolves to first pair
+        zoneTransition.before = &zone->rules[ruleIndex - 1];
+        zoneTransition.after = &zone->rules[ruleIndex];
+    }
+    return zoneTransition;
+}
+
+static uint32_t findFirstDeltaNotBefore(const CompactTimeZoneRules *compactRules, uint32_t delta) {  // binary search, lower bound
+    uint32_t leftIndex = 0;
+    uint32_t rightIndex = compactRules->ruleCount;
+    while (leftIndex < rightIndex) {
+        uint32_t middleIndex = leftIndex + (rightIndex - leftIndex) / 2;
+        if (compactRules->transitionDeltas[middleIndex] < delta) {
+            leftIndex = middleIndex + 1;
+        } else {
+            rightIndex = middleIndex;
+        }
+    }
+    return leftIndex;
+}
+
+static void decodeCompactRule(const CompactTimeZoneRules *compactRules, uint32_t ruleIndex, TimeZoneRule *rule) {
+    const ZoneOffsetType *offsetType = &compactRules->offsetTypes[compactRules->offsetTypeIndexes[ruleIndex]];
+    rule->gmtOffset = offsetType->gmtOffset;
+    rule->isDaylightTime = offsetType->isDaylightTime;
+    rule->transition = compactRules->baseTransition + compactRules->transitionDeltas[ruleIndex];
+}
+
+static bool findOffsetTypeIndex(const TimeZoneRule *rule, ZoneOffsetType *offsetTypes, uint8_t *offsetTypeCount,
+                                uint8_t offsetTypesCapacity, uint8_t *typeIndex) {   // appends new offset to palette
+    uint8_t index = 0;
+    while (index < *offsetTypeCount &&
+           (offsetTypes[index].gmtOffset != rule->gmtOffset || offsetTypes[index].isDaylightTime != rule->isDaylightTime)) {
+        index++;
+    }
+    if (index == *offsetTypeCount) {
+        if (*offsetTypeCount == offsetTypesCapacity) return false;
+        offsetTypes[index].gmtOffset = rule->gmtOffset;
+        offsetTypes[index].isDaylightTime = rule->isDaylightTime;
+        (*offsetTypeCount)++;
+    }
+    *typeIndex = index;
+    return true;
+}
+
+static uint32_t writeVarint(uint64_t value, uint8_t *data) {     // LEB128, low 7 bits first
+    uint32_t length = 0;
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        data[length++] = byte | (value != 0 ? 0x80 : 0);
+    } while (value != 0);
+    return length;
+}
+
+static uint32_t readVarint(const uint8_t *data, uint32_t length, uint64_t *value) {
+    *value = 0;
+    for (uint32_t i = 0; i < length && i < VARINT_RULE_MAX_LENGTH; i++) {
+        *value |= (uint64_t) (data[i] & 0x7F) << (7 * i);
+        if ((data[i] & 0x80) == 0) return i + 1;
+    }
+    return 0;   // truncated value
+}
+
+/* Fills tree nodes in order of sorted transitions: children before each slot, slot itself, then the last child*/
+static void fillTransitionBlocks(const TimeZoneRule *rules, uint32_t ruleCount, ZoneTransitionBlock *blocks, uint32_t blockCount, uint32_t blockIndex, uint32_t *ruleIndex) {
+    if (blockIndex >= blockCount) return;
+    uint32_t firstChildIndex = blockIndex * (ZONE_TRANSITION_BLOCK_SIZE + 1) + 1;
+    for (uint32_t i = 0; i < ZONE_TRANSITION_BLOCK_SIZE; i++) {
+        fillTransitionBlocks(rules, ruleCount, blocks, blockCount, firstChildIndex + i, ruleIndex);
+        bool hasRule = *ruleIndex < ruleCount;
+        blocks[blockIndex].transitions[i] = hasRule ? rules[*ruleIndex].transition : INT64_MAX;
+        blocks[blockIndex].ruleIndexes[i] = hasRule ? *ruleIndex : ruleCount;
+        *ruleIndex += hasRule;
+    }
+    fillTransitionBlocks(rules, ruleCount, blocks, blockCount, firstChildIndex + ZONE_TRANSITION_BLOCK_SIZE, ruleIndex);
+}
+
+/* Descends tree from root, slot is the count of node transitions before epoch seconds.
+ * The last found transition not before epoch seconds is the lower bound, rule count when there is none*/
+static uint32_t searchTransitionBlocks(const ZoneTransitionIndex *index, int64_t epochSeconds) {
+    uint32_t ruleIndex = index->ruleCount;
+    uint32_t blockIndex = 0;
+    while (blockIndex < index->blockCount) {
+        const ZoneTransitionBlock *block = &index->blocks[blockIndex];
+        uint32_t slot = 0;
+        for (uint32_t i = 0; i < ZONE_TRANSITION_BLOCK_SIZE; i++) {
+            slot += block->transitions[i] < epochSeconds;
+        }
+        ruleIndex = (slot < ZONE_TRANSITION_BLOCK_SIZE) ? block->ruleIndexes[slot] : ruleIndex;
+        blockIndex = blockIndex * (ZONE_TRANSITION_BLOCK_SIZE + 1) + slot + 1;
+    }
+    return ruleIndex;
+}
+
+#ifdef ZONE_SEARCH_X86_KERNELS
+__attribute__((target("sse4.2")))
+static uint32_t searchTransitionBlocksSse42(const ZoneTransitionIndex *index, int64_t epochSeconds) {
+    __m128i target = _mm_set1_epi64x(epochSeconds);
+    uint32_t ruleIndex = index->ruleCount;
+    uint32_t blockIndex = 0;
+    while (blockIndex < index->blockCount) {
+        const ZoneTransitionBlock *block = &index->blocks[blockIndex];
+        __m128i lowBefore = _mm_cmpgt_epi64(target, _mm_loadu_si128((const __m128i *) &block->transitions[0]));
+        __m128i highBefore = _mm_cmpgt_epi64(target, _mm_loadu_si128((const __m128i *) &block->transitions[2]));
+        uint32_t mask = (uint32_t) _mm_movemask_pd(_mm_castsi128_pd(lowBefore)) | ((uint32_t) _mm_movemask_pd(_mm_castsi128_pd(highBefore)) << 2);
+        uint32_t slot = __builtin_popcount(mask);
+        ruleIndex = (slot < ZONE_TRANSITION_BLOCK_SIZE) ? block->ruleIndexes[slot] : ruleIndex;
+        blockIndex = blockIndex * (ZONE_TRANSITION_BLOCK_SIZE + 1) + slot + 1;
+    }
+    return ruleIndex;
+}
+
+__attribute__((target("avx2")))
+static uint32_t searchTransitionBlocksAvx2(const ZoneTransitionIndex *index, int64_t epochSeconds) {
+    __m256i target = _mm256_set1_epi64x(epochSeconds);
+    uint32_t ruleIndex = index->ruleCount;
+    uint32_t blockIndex = 0;
+    while (blockIndex < index->blockCount) {
+        const ZoneTransitionBlock *block = &index->blocks[blockIndex];
+        __m256i isBefore = _mm256_cmpgt_epi64(target, _mm256_loadu_si256((const __m256i *) block->transitions));
+        uint32_t slot = __builtin_popcount((uint32_t) _mm256_movemask_pd(_mm256_castsi256_pd(isBefore)));
+        ruleIndex = (slot < ZONE_TRANSITION_BLOCK_SIZE) ? block->ruleIndexes[slot] : ruleIndex;
+        blockIndex = blockIndex * (ZONE_TRANSITION_BLOCK_SIZE + 1) + slot + 1;
+    }
+    return ruleIndex;
+}
+#endif
+
+static int64_t epochDayOfYearStart(int64_t year) {    // leap days before 1970 are 1969 / 4 - 1969 / 100 + 1969 / 400
+    int64_t previousYear = year - 1;
+    return (year - 1970) * 365 + floorDiv(previousYear, 4) - floorDiv(previousYear, 100) + floorDiv(previousYear, 400) - 477;
+}
+
+static int64_t yearOfEpochDay(int64_t epochDay) {
+    int64_t year = 1970 + floorDiv(epochDay * 400, DAYS_PER_CYCLE);    // average year length, off by one at most
+    if (epochDay < epochDayOfYearStart(year)) return year - 1;
+    return (epochDay >= epochDayOfYearStart(year + 1)) ? year + 1 : year;
+}
+
+static int64_t recurringDateToEpochSecond(const ZoneRecurringDate *date, int64_t year, int32_t offset) {
+    bool leapYear = isLeapYear(year);
+    int64_t epochDay = epochDayOfYearStart(year);
+    if (date->type == RECURRING_DATE_MONTH_WEEK_DAY) {
+        epochDay += firstDayOfYearByMonth(date->month, leapYear) - 1;
+        int64_t firstWeekDay = floorMod(epochDay + 4, 7);    // 1970-01-01 is Thursday, POSIX week starts from Sunday
+        int64_t dayOfMonth = floorMod(date->day - firstWeekDay, 7) + (date->week - 1) * 7;
+        while (dayOfMonth >= lengthOfMonth(date->month, leapYear)) {    // week 5 means the last week of month
+            dayOfMonth -= 7;
+        }
+        epochDay += dayOfMonth;
+
+    } else {
+        int64_t dayOfYear = date->day;
+        if (date->type == RECURRING_DATE_JULIAN_DAY) {
+            dayOfYear = date->day - 1 + ((leapYear && date->day >= 60) ? 1 : 0);
+        }
+        epochDay += dayOfYear;
+    }
+    return epochDay * SECONDS_PER_DAY + date->secondOfDay - offset;
+}
+
+static bool parseRecurringZoneName(const char **text) {    // "CET" or quoted "<+03>"
+    const char *start = *text;
+    const char *end = start;
+    if (*start == '<') {
+        end++;
+        while (isalnum((unsigned char) *end) || *end == '+' || *end == '-') {
+            end++;
+        }
+        if (*end != '>' || end - start < 2) return false;
+        *text = end + 1;
+        return true;
+    }
+
+    while (isalpha((unsigned char) *end)) {
+        end++;
+    }
+    *text = end;
+    return end - start >= 3;
+}
+
+static bool parseRecurringNumber(const char **text, uint32_t maxValue, uint32_t *value) {
+    const char *digits = *text;
+    uint32_t number = 0;
+    while (isdigit((unsigned char) *digits)) {
+        number = number * 10 + (*digits - '0');
+        if (number > maxValue) return false;
+        digits++;
+    }
+    if (digits == *text) return false;
+    *text = digits;
+    *value = number;
+    return true;
+}
+
+static bool parseRecurringSeconds(const char **text, int32_t *seconds) {    // [+|-]hh[:mm[:ss]]
+    int32_t sign = 1;
+    if (**text == '+' || **text == '-') {
+        sign = (**text == '-') ? -1 : 1;
+        (*text)++;
+    }
+
+    uint32_t hours;
+    uint32_t minutes = 0;
+    uint32_t secondsOfMinute = 0;
+    if (!parseRecurringNumber(text, RECURRING_MAX_HOURS, &hours)) return false;
+    if (**text == ':') {
+        (*text)++;
+        if (!parseRecurringNumber(text, MINUTES_PER_HOUR - 1, &minutes)) return false;
+        if (**text == ':') {
+            (*text)++;
+            if (!parseRecurringNumber(text, SECONDS_PER_MINUTE - 1, &secondsOfMinute)) return false;
+        }
+    }
+    *seconds = sign * (int32_t) (hours * SECONDS_PER_HOUR + minutes * SECONDS_PER_MINUTE + secondsOfMinute);
+    return true;
+}
+
+static bool parseRecurringDate(const char **text, ZoneRecurringDate *date) {   // "Mm.w.d", "Jn" or "n" with optional "/time"
+    uint32_t month;
+    uint32_t week;
+    uint32_t day;
+    if (**text == 'M') {
+        (*text)++;
+        if (!parseRecurringNumber(text, DECEMBER, &month) || month < JANUARY || *(*text)++ != '.') return false;
+        if (!parseRecurringNumber(text, 5, &week) || week < 1 || *(*text)++ != '.') return false;
+        if (!parseRecurringNumber(text, 6, &day)) return false;
+        date->type = RECURRING_DATE_MONTH_WEEK_DAY;
+        date->month = month;
+        date->week = week;
+        date->day = day;
+
+    } else if (**text == 'J') {
+        (*text)++;
+        if (!parseRecurringNumber(text, 365, &day) || day < 1) return false;
+        date->type = RECURRING_DATE_JULIAN_DAY;
+        date->day = day;
+
+    } else {
+        if (!parseRecurringNumber(text, 365, &day)) return false;
+        date->type = RECURRING_DATE_ZERO_BASED_DAY;
+        date->day = day;
+    }
+
+    date->secondOfDay = RECURRING_DEFAULT_SECOND_OF_DAY;
+    if (**text == '/') {
+        (*text)++;
+        return parseRecurringSeconds(text, &date->secondOfDay);
+    }
+    return true;
+}
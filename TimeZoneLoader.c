@@ -0,0 +1,302 @@
+#include "TimeZoneLoader.h"
+
+#ifdef ENABLE_TIME_ZONE_TZIF_LOADER
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define TZIF_MAGIC "TZif"
+#define TZIF_MAGIC_LENGTH 4
+#define TZIF_HEADER_LENGTH 44
+#define TZIF_COUNTS_OFFSET 20
+#define TZIF_TYPE_LENGTH 6
+#define TZIF_V1_TIME_LENGTH 4
+#define TZIF_V2_TIME_LENGTH 8
+#define TZIF_V1_LEAP_LENGTH 8
+#define TZIF_V2_LEAP_LENGTH 12
+#define ZONE_ABBREVIATION_MAX_LENGTH 16
+#define TZIF_FOOTER_MAX_LENGTH 64
+
+typedef struct TzifHeader {
+    uint32_t isUtCount;
+    uint32_t isStdCount;
+    uint32_t leapCount;
+    uint32_t timeCount;
+    uint32_t typeCount;
+    uint32_t charCount;
+} TzifHeader;
+
+typedef struct TzifData {      // points into mapped file
+    TzifHeader header;
+    const uint8_t *transitions;
+    const uint8_t *typeIndexes;
+    const uint8_t *types;
+    const char *abbreviations;
+    const char *footer;         // POSIX TZ string between new lines, NULL if absent
+    size_t footerLength;
+} TzifData;
+
+typedef struct LoadedTimeZone {
+    TimeZone zone;
+    struct LoadedTimeZone *next;
+    const char *names[4];
+    char standardName[ZONE_ABBREVIATION_MAX_LENGTH];
+    char daylightName[ZONE_ABBREVIATION_MAX_LENGTH];
+    ZoneRecurringRule recurringRule;
+    TimeZoneRule rules[];       // rules with terminating entry, followed by zone id
+} LoadedTimeZone;
+
+static char zoneInfoDirectory[ZONE_INFO_PATH_MAX_LENGTH] = ZONE_INFO_DEFAULT_DIRECTORY;
+static LoadedTimeZone *loadedZones = NULL;
+
+static bool isZoneIdValid(const char *zoneId);
+static LoadedTimeZone *readLoadedZone(const char *directory, const char *zoneId);
+static LoadedTimeZone *loadTzifFile(const char *zoneId, const char *path);
+static bool parseTzifData(const uint8_t *data, size_t size, TzifData *tzif);
+static bool parseTzifHeader(const uint8_t *data, size_t size, TzifHeader *header);
+static size_t tzifDataLength(const TzifHeader *header, uint32_t timeLength, uint32_t leapLength);
+static LoadedTimeZone *createLoadedZone(const char *zoneId, const TzifData *tzif);
+static void setLoadedZoneNames(LoadedTimeZone *loadedZone, const TzifData *tzif);
+static void setLoadedZoneRecurringRule(LoadedTimeZone *loadedZone, const TzifData *tzif);
+static void findTzifFooter(const uint8_t *data, size_t size, TzifData *tzif);
+static void copyAbbreviation(char *buffer, const TzifData *tzif, uint8_t typeIndex);
+static uint32_t readBigEndian32(const uint8_t *data);
+static int64_t readBigEndian64(const uint8_t *data);
+
+
+bool setZoneInfoDirectory(const char *directory) {
+    if (directory == NULL) directory = ZONE_INFO_DEFAULT_DIRECTORY;
+    if (strlen(directory) >= ZONE_INFO_PATH_MAX_LENGTH) return false;
+    strcpy(zoneInfoDirectory, directory);
+    return true;
+}
+
+const TimeZone *loadTimeZone(const char *zoneId) {
+    if (!isZoneIdValid(zoneId)) return NULL;
+
+    for (LoadedTimeZone *loadedZone = loadedZones; loadedZone != NULL; loadedZone = loadedZone->next) {
+        if (strcmp(loadedZone->zone.id, zoneId) == 0) {
+            return &loadedZone->zone;
+        }
+    }
+
+    LoadedTimeZone *loadedZone = readLoadedZone(zoneInfoDirectory, zoneId);
+    if (loadedZone == NULL) return NULL;
+    loadedZone->next = loadedZones;
+    loadedZones = loadedZone;
+    return &loadedZone->zone;
+}
+
+void freeLoadedTimeZones() {
+    while (loadedZones != NULL) {
+        LoadedTimeZone *next = loadedZones->next;
+        free(loadedZones);
+        loadedZones = next;
+    }
+}
+
+const TimeZone *readTimeZone(const char *directory, const char *zoneId) {
+    LoadedTimeZone *loadedZone = readLoadedZone(directory != NULL ? directory : zoneInfoDirectory, zoneId);
+    return loadedZone != NULL ? &loadedZone->zone : NULL;
+}
+
+void freeTimeZone(const TimeZone *zone) {
+    free((void *) zone);    // zone is the first member of loaded zone allocation
+}
+
+static LoadedTimeZone *readLoadedZone(const char *directory, const char *zoneId) {
+    if (!isZoneIdValid(zoneId)) return NULL;
+    char path[ZONE_INFO_PATH_MAX_LENGTH * 2];
+    if (snprintf(path, sizeof(path), "%s/%s", directory, zoneId) >= (int) sizeof(path)) return NULL;
+    return loadTzifFile(zoneId, path);
+}
+
+static bool isZoneIdValid(const char *zoneId) {
+    if (zoneId == NULL || *zoneId == '\0' || *zoneId == '/') return false;
+    if (strstr(zoneId, "..") != NULL) return false;     // do not allow to leave zone info directory
+    for (const char *ch = zoneId; *ch != '\0'; ch++) {
+        bool isValidZoneChar = isalnum((unsigned char) *ch) || *ch == '/' || *ch == '-' || *ch == '_' || *ch == '+';
+        if (!isValidZoneChar) return false;
+    }
+    return true;
+}
+
+static LoadedTimeZone *loadTzifFile(const char *zoneId, const char *path) {
+    int fileDescriptor = open(path, O_RDONLY);
+    if (fileDescriptor < 0) return NULL;
+
+    struct stat fileStat;
+    if (fstat(fileDescriptor, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size < TZIF_HEADER_LENGTH) {
+        close(fileDescriptor);
+        return NULL;
+    }
+
+    size_t size = (size_t) fileStat.st_size;
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED) return NULL;
+
+    TzifData tzif;
+    LoadedTimeZone *loadedZone = NULL;
+    if (parseTzifData(mapping, size, &tzif)) {
+        loadedZone = createLoadedZone(zoneId, &tzif);
+    }
+    munmap(mapping, size);
+    return loadedZone;
+}
+
+static bool parseTzifData(const uint8_t *data, size_t size, TzifData *tzif) {
+    TzifHeader header;
+    if (!parseTzifHeader(data, size, &header)) return false;
+    if (data[TZIF_MAGIC_LENGTH] < '2') return false;   // only 64-bit data of version 2 and later is supported
+
+    size_t v1DataLength = tzifDataLength(&header, TZIF_V1_TIME_LENGTH, TZIF_V1_LEAP_LENGTH);
+    if (v1DataLength > size - TZIF_HEADER_LENGTH) return false;
+    size_t v2HeaderOffset = TZIF_HEADER_LENGTH + v1DataLength;
+    if (!parseTzifHeader(data + v2HeaderOffset, size - v2HeaderOffset, &tzif->header)) return false;
+
+    const TzifHeader *v2Header = &tzif->header;
+    size_t v2DataOffset = v2HeaderOffset + TZIF_HEADER_LENGTH;
+    size_t v2DataLength = tzifDataLength(v2Header, TZIF_V2_TIME_LENGTH, TZIF_V2_LEAP_LENGTH);
+    if (v2DataLength > size - v2DataOffset) return false;
+    if (v2Header->typeCount == 0 || v2Header->timeCount >= UINT16_MAX) return false;
+    if (v2Header->leapCount > 0) return false;     // "right/" zones count leap seconds, epoch seconds of library don't
+
+    tzif->transitions = data + v2DataOffset;
+    tzif->typeIndexes = tzif->transitions + (size_t) v2Header->timeCount * TZIF_V2_TIME_LENGTH;
+    tzif->types = tzif->typeIndexes + v2Header->timeCount;
+    tzif->abbreviations = (const char *) (tzif->types + (size_t) v2Header->typeCount * TZIF_TYPE_LENGTH);
+
+    for (uint32_t i = 0; i < v2Header->timeCount; i++) {
+        if (tzif->typeIndexes[i] >= v2Header->typeCount) return false;
+    }
+    findTzifFooter(data + v2DataOffset + v2DataLength, size - v2DataOffset - v2DataLength, tzif);
+    return true;
+}
+
+static void findTzifFooter(const uint8_t *data, size_t size, TzifData *tzif) {
+    tzif->footer = NULL;
+    tzif->footerLength = 0;
+    if (size < 2 || data[0] != '\n') return;
+
+    const uint8_t *footerEnd = memchr(data + 1, '\n', size - 1);
+    if (footerEnd == NULL) return;
+    tzif->footer = (const char *) (data + 1);
+    tzif->footerLength = footerEnd - data - 1;
+}
+
+static bool parseTzifHeader(const uint8_t *data, size_t size, TzifHeader *header) {
+    if (size < TZIF_HEADER_LENGTH || memcmp(data, TZIF_MAGIC, TZIF_MAGIC_LENGTH) != 0) return false;
+    const uint8_t *counts = data + TZIF_COUNTS_OFFSET;
+    header->isUtCount = readBigEndian32(counts);
+    header->isStdCount = readBigEndian32(counts + 4);
+    header->leapCount = readBigEndian32(counts + 8);
+    header->timeCount = readBigEndian32(counts + 12);
+    header->typeCount = readBigEndian32(counts + 16);
+    header->charCount = readBigEndian32(counts + 20);
+    return true;
+}
+
+static size_t tzifDataLength(const TzifHeader *header, uint32_t timeLength, uint32_t leapLength) {
+    return (size_t) header->timeCount * (timeLength + 1) +
+           (size_t) header->typeCount * TZIF_TYPE_LENGTH +
+           header->charCount +
+           (size_t) header->leapCount * leapLength +
+           header->isStdCount +
+           header->isUtCount;
+}
+
+static LoadedTimeZone *createLoadedZone(const char *zoneId, const TzifData *tzif) {
+    uint32_t ruleCount = tzif->header.timeCount;
+    size_t idLength = strlen(zoneId) + 1;
+    LoadedTimeZone *loadedZone = malloc(sizeof(LoadedTimeZone) + (ruleCount + 1) * sizeof(TimeZoneRule) + idLength);
+    if (loadedZone == NULL) return NULL;
+
+    for (uint32_t i = 0; i < ruleCount; i++) {
+        const uint8_t *type = tzif->types + tzif->typeIndexes[i] * TZIF_TYPE_LENGTH;
+        loadedZone->rules[i].gmtOffset = (int32_t) readBigEndian32(type);
+        loadedZone->rules[i].isDaylightTime = type[4] != 0;
+        loadedZone->rules[i].transition = readBigEndian64(tzif->transitions + (size_t) i * TZIF_V2_TIME_LENGTH);
+    }
+    loadedZone->rules[ruleCount] = (TimeZoneRule) {.transition = 0};
+
+    char *id = (char *) &loadedZone->rules[ruleCount + 1];
+    memcpy(id, zoneId, idLength);
+
+    uint8_t currentType = ruleCount > 0 ? tzif->typeIndexes[ruleCount - 1] : 0;
+    loadedZone->zone.id = id;
+    loadedZone->zone.utcOffset = (int32_t) readBigEndian32(tzif->types + currentType * TZIF_TYPE_LENGTH);
+    loadedZone->zone.rules = loadedZone->rules;
+    loadedZone->zone.ruleCount = (uint16_t) ruleCount;
+    loadedZone->next = NULL;
+    setLoadedZoneNames(loadedZone, tzif);
+    setLoadedZoneRecurringRule(loadedZone, tzif);
+    return loadedZone;
+}
+
+static void setLoadedZoneNames(LoadedTimeZone *loadedZone, const TzifData *tzif) {
+    const TimeZone *compiledZone = findTimeZone(loadedZone->zone.id);
+    if (compiledZone != NULL) {
+        loadedZone->zone.names = compiledZone->names;
+        return;
+    }
+
+    int32_t standardType = -1;
+    int32_t daylightType = -1;
+    for (uint32_t i = 0; i < tzif->header.timeCount; i++) {     // latest used types describe zone names
+        uint8_t typeIndex = tzif->typeIndexes[i];
+        bool isDaylightTime = tzif->types[typeIndex * TZIF_TYPE_LENGTH + 4] != 0;
+        if (isDaylightTime) {
+            daylightType = typeIndex;
+        } else {
+            standardType = typeIndex;
+        }
+    }
+    standardType = standardType < 0 ? 0 : standardType;
+    daylightType = daylightType < 0 ? standardType : daylightType;
+
+    copyAbbreviation(loadedZone->standardName, tzif, standardType);
+    copyAbbreviation(loadedZone->daylightName, tzif, daylightType);
+    loadedZone->names[ZONE_LONG_NAME_STD_INDEX] = loadedZone->standardName;
+    loadedZone->names[ZONE_SHORT_NAME_STD_INDEX] = loadedZone->standardName;
+    loadedZone->names[ZONE_LONG_NAME_DTS_INDEX] = loadedZone->daylightName;
+    loadedZone->names[ZONE_SHORT_NAME_DTS_INDEX] = loadedZone->daylightName;
+    loadedZone->zone.names = loadedZone->names;
+}
+
+static void setLoadedZoneRecurringRule(LoadedTimeZone *loadedZone, const TzifData *tzif) {
+    loadedZone->zone.recurringRule = NULL;
+    if (tzif->footer == NULL || tzif->footerLength >= TZIF_FOOTER_MAX_LENGTH) return;
+
+    char footer[TZIF_FOOTER_MAX_LENGTH];
+    memcpy(footer, tzif->footer, tzif->footerLength);
+    footer[tzif->footerLength] = '\0';
+    if (parseZoneRecurringRule(footer, &loadedZone->recurringRule) && loadedZone->recurringRule.hasDaylightTime) {
+        loadedZone->zone.recurringRule = &loadedZone->recurringRule;
+    }
+}
+
+static void copyAbbreviation(char *buffer, const TzifData *tzif, uint8_t typeIndex) {
+    uint8_t abbreviationIndex = tzif->types[typeIndex * TZIF_TYPE_LENGTH + 5];
+    uint32_t i = 0;
+    while (abbreviationIndex + i < tzif->header.charCount && i < ZONE_ABBREVIATION_MAX_LENGTH - 1 &&
+           tzif->abbreviations[abbreviationIndex + i] != '\0') {
+        buffer[i] = tzif->abbreviations[abbreviationIndex + i];
+        i++;
+    }
+    buffer[i] = '\0';
+}
+
+static uint32_t readBigEndian32(const uint8_t *data) {
+    return ((uint32_t) data[0] << 24) | ((uint32_t) data[1] << 16) | ((uint32_t) data[2] << 8) | (uint32_t) data[3];
+}
+
+static int64_t readBigEndian64(const uint8_t *data) {
+    return (int64_t) (((uint64_t) readBigEndian32(data) << 32) | readBigEndian32(data + 4));
+}
+
+#endif
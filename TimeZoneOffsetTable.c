@@ -0,0 +1,106 @@
+#include <stdlib.h>
+
+#include "TimeZoneOffsetTable.h"
+#include "LocalDate.h"
+
+#define ZONE_OFFSET_TABLE_BUCKET_SECONDS (1 << ZONE_OFFSET_TABLE_BUCKET_SHIFT)
+#define ZONE_OFFSET_TABLE_MAX_YEARS 1000
+
+
+static ZoneTransition findAnyZoneTransition(int64_t epochSeconds, const TimeZone *zone, TimeZoneRule decodedRules[2]);
+static bool isSameZoneTransition(const ZoneTransition *transition, const ZoneTransition *other);
+static bool hasOffsetChange(int64_t firstEpochSecond, int64_t lastEpochSecond, const TimeZone *zone);
+static bool findOffsetIndex(ZoneOffsetTable *table, int32_t offset, uint8_t *offsetIndex);
+
+
+bool initZoneOffsetTable(ZoneOffsetTable *table, const TimeZone *zone, int64_t fromYear, int64_t toYear) {
+    if (table == NULL || zone == NULL || fromYear > toYear || toYear - fromYear >= ZONE_OFFSET_TABLE_MAX_YEARS) return false;
+
+    Date firstDate = {.year = fromYear, .month = JANUARY, .day = 1};
+    Date endDate = {.year = toYear + 1, .month = JANUARY, .day = 1};
+    int64_t firstEpochSecond = dateToEpochDay(&firstDate) * SECONDS_PER_DAY;
+    int64_t endEpochSecond = dateToEpochDay(&endDate) * SECONDS_PER_DAY;
+    uint32_t bucketCount = (uint32_t) ((endEpochSecond - firstEpochSecond + ZONE_OFFSET_TABLE_BUCKET_SECONDS - 1) >> ZONE_OFFSET_TABLE_BUCKET_SHIFT);
+
+    uint8_t *buckets = malloc(bucketCount);
+    if (buckets == NULL) return false;
+    table->zone = zone;
+    table->firstEpochSecond = firstEpochSecond;
+    table->bucketCount = bucketCount;
+    table->buckets = buckets;
+    table->offsetCount = 0;
+
+    for (uint32_t i = 0; i < bucketCount; i++) {
+        int64_t bucketStart = firstEpochSecond + ((int64_t) i << ZONE_OFFSET_TABLE_BUCKET_SHIFT);
+        uint8_t offsetIndex;
+        if (!findOffsetIndex(table, resolveTimeZoneOffset(bucketStart, zone), &offsetIndex)) {
+            freeZoneOffsetTable(table);
+            return false;
+        }
+        bool isChanged = hasOffsetChange(bucketStart, bucketStart + ZONE_OFFSET_TABLE_BUCKET_SECONDS - 1, zone);
+        buckets[i] = isChanged ? (offsetIndex | ZONE_OFFSET_TABLE_CHANGE_FLAG) : offsetIndex;
+    }
+    return true;
+}
+
+int32_t resolveTableTimeZoneOffset(int64_t epochSeconds, const ZoneOffsetTable *table) {
+    if (epochSeconds >= table->firstEpochSecond) {
+        uint64_t bucketIndex = (uint64_t) (epochSeconds - table->firstEpochSecond) >> ZONE_OFFSET_TABLE_BUCKET_SHIFT;
+        if (bucketIndex < table->bucketCount) {
+            uint8_t bucket = table->buckets[bucketIndex];
+            if ((bucket & ZONE_OFFSET_TABLE_CHANGE_FLAG) == 0) {
+                return table->offsets[bucket];
+            }
+        }
+    }
+    return resolveTimeZoneOffset(epochSeconds, table->zone);
+}
+
+void freeZoneOffsetTable(ZoneOffsetTable *table) {
+    if (table == NULL) return;
+    free(table->buckets);
+    table->buckets = NULL;
+    table->bucketCount = 0;
+    table->offsetCount = 0;
+}
+
+static ZoneTransition findAnyZoneTransition(int64_t epochSeconds, const TimeZone *zone, TimeZoneRule decodedRules[2]) {
+    ZoneTransition zoneTransition = findZoneRuleTransition(epochSeconds, zone);
+    if (zoneTransition.before == NULL) {
+        zoneTransition = findRecurringRuleTransition(epochSeconds, zone, decodedRules);
+    }
+    return zoneTransition;
+}
+
+static bool isSameZoneTransition(const ZoneTransition *transition, const ZoneTransition *other) {
+    if (transition->before == NULL || other->before == NULL) {
+        return transition->before == other->before;
+    }
+    return transition->before->transition == other->before->transition && transition->after->transition == other->after->transition;
+}
+
+/* Offset changes where rules pair changes, or at the 'after' transition of the pair, same as resolveTimeZoneOffset()*/
+static bool hasOffsetChange(int64_t firstEpochSecond, int64_t lastEpochSecond, const TimeZone *zone) {
+    TimeZoneRule firstRules[2];
+    TimeZoneRule lastRules[2];
+    ZoneTransition firstTransition = findAnyZoneTransition(firstEpochSecond, zone, firstRules);
+    ZoneTransition lastTransition = findAnyZoneTransition(lastEpochSecond, zone, lastRules);
+    if (!isSameZoneTransition(&firstTransition, &lastTransition)) return true;
+    if (firstTransition.before == NULL) return false;
+
+    int64_t transition = firstTransition.after->transition;
+    return firstEpochSecond < transition && transition <= lastEpochSecond;
+}
+
+static bool findOffsetIndex(ZoneOffsetTable *table, int32_t offset, uint8_t *offsetIndex) {
+    for (uint8_t i = 0; i < table->offsetCount; i++) {
+        if (table->offsets[i] == offset) {
+            *offsetIndex = i;
+            return true;
+        }
+    }
+    if (table->offsetCount == ZONE_OFFSET_TABLE_MAX_OFFSETS) return false;
+    table->offsets[table->offsetCount] = offset;
+    *offsetIndex = table->offsetCount++;
+    return true;
+}
@@ -0,0 +1,114 @@
+#include <stdlib.h>
+
+#include "TimeZoneRulesCache.h"
+
+#if defined(ENABLE_TIME_ZONE_COMPRESSED_RULES) || defined(ENABLE_TIME_ZONE_COMPACT_RULES)
+
+#ifdef ENABLE_TIME_ZONE_COMPRESSED_RULES    // layout of generated zone data, varint if both are defined
+#define ZONE_PACKED_RULES ZONE_VARINT_RULES
+#define unpackZoneRules unpackVarintTimeZoneRules
+#else
+#define ZONE_PACKED_RULES ZONE_COMPACT_RULES
+#define unpackZoneRules unpackTimeZoneRules
+#endif
+
+typedef struct DecodedTimeZone {
+    TimeZone zone;
+    TimeZoneRule rules[];   // with terminating entry, empty for alias that shares rules of canonical zone
+} DecodedTimeZone;
+
+static DecodedTimeZone **decodedZones = NULL;     // slot for each ZONE_LIST entry, allocated on first access
+static size_t decodedSize = 0;
+
+static DecodedTimeZone **getDecodedZoneSlots();
+static DecodedTimeZone *decodeTimeZone(uint16_t zoneIndex, size_t *size);
+
+#ifdef ENABLE_TIME_ZONE_COMPACT_RULES
+const CompactTimeZoneRules *findCompactTimeZoneRules(const TimeZone *zone) {
+    ZoneHandle handle = zoneHandleOf(zone);
+    return handle < ZONE_LIST_LENGTH ? ZONE_COMPACT_RULES[handle] : NULL;
+}
+#endif
+
+const TimeZone *getDecodedTimeZone(uint16_t zoneIndex) {
+    if (zoneIndex >= ZONE_LIST_LENGTH) return NULL;
+    if (ZONE_PACKED_RULES[zoneIndex] == NULL) return &ZONE_LIST[zoneIndex];
+    DecodedTimeZone **slots = getDecodedZoneSlots();
+    if (slots == NULL) return &ZONE_LIST[zoneIndex];
+
+    DecodedTimeZone *decoded = __atomic_load_n(&slots[zoneIndex], __ATOMIC_ACQUIRE);
+    if (decoded == NULL) {
+        size_t size;
+        decoded = decodeTimeZone(zoneIndex, &size);
+        if (decoded == NULL) return &ZONE_LIST[zoneIndex];
+
+        DecodedTimeZone *expected = NULL;
+        if (__atomic_compare_exchange_n(&slots[zoneIndex], &expected, decoded, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            __atomic_add_fetch(&decodedSize, size, __ATOMIC_RELAXED);
+        } else {    // decoded by other thread at the same time
+            free(decoded);
+            decoded = expected;
+        }
+    }
+    return &decoded->zone;
+}
+
+void freeDecodedTimeZones() {
+    if (decodedZones == NULL) return;
+    for (uint16_t i = 0; i < ZONE_LIST_LENGTH; i++) {
+        free(decodedZones[i]);
+    }
+    free(decodedZones);
+    decodedZones = NULL;
+    decodedSize = 0;
+}
+
+size_t getDecodedTimeZonesSize() {
+    return __atomic_load_n(&decodedSize, __ATOMIC_RELAXED);
+}
+
+static DecodedTimeZone **getDecodedZoneSlots() {
+    DecodedTimeZone **slots = __atomic_load_n(&decodedZones, __ATOMIC_ACQUIRE);
+    if (slots != NULL) return slots;
+
+    slots = calloc(ZONE_LIST_LENGTH, sizeof(DecodedTimeZone *));
+    if (slots == NULL) return NULL;
+    DecodedTimeZone **expected = NULL;
+    if (!__atomic_compare_exchange_n(&decodedZones, &expected, slots, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        free(slots);
+        return expected;
+    }
+    __atomic_add_fetch(&decodedSize, ZONE_LIST_LENGTH * sizeof(DecodedTimeZone *), __ATOMIC_RELAXED);
+    return slots;
+}
+
+static DecodedTimeZone *decodeTimeZone(uint16_t zoneIndex, size_t *size) {
+    uint16_t ruleCount = ZONE_PACKED_RULES[zoneIndex]->ruleCount;
+    uint16_t linkIndex = ZONE_LINK_INDEXES[zoneIndex];
+    if (linkIndex != zoneIndex && ZONE_PACKED_RULES[linkIndex] == ZONE_PACKED_RULES[zoneIndex]) {    // alias, rules of canonical zone
+        const TimeZone *canonicalZone = getDecodedTimeZone(linkIndex);
+        if (canonicalZone->rules == NULL) return NULL;
+        DecodedTimeZone *decoded = malloc(sizeof(DecodedTimeZone));
+        if (decoded == NULL) return NULL;
+        decoded->zone = ZONE_LIST[zoneIndex];
+        decoded->zone.rules = canonicalZone->rules;
+        decoded->zone.ruleCount = canonicalZone->ruleCount;
+        *size = sizeof(DecodedTimeZone);
+        return decoded;
+    }
+
+    *size = sizeof(DecodedTimeZone) + (ruleCount + 1) * sizeof(TimeZoneRule);
+    DecodedTimeZone *decoded = malloc(*size);
+    if (decoded == NULL) return NULL;
+    if (!unpackZoneRules(ZONE_PACKED_RULES[zoneIndex], decoded->rules, ruleCount)) {
+        free(decoded);
+        return NULL;
+    }
+    decoded->rules[ruleCount] = (TimeZoneRule) {.transition = 0};
+    decoded->zone = ZONE_LIST[zoneIndex];
+    decoded->zone.rules = decoded->rules;
+    decoded->zone.ruleCount = ruleCount;
+    return decoded;
+}
+
+#endif
@@ -0,0 +1,156 @@
+#include "ZoneDatabase.h"
+
+#ifdef ENABLE_TIME_ZONE_TZIF_LOADER
+
+#include <stdlib.h>
+
+#define CACHE_LINE_SIZE 64
+#define READER_INACTIVE 0       // reader epoch outside of read section, global epoch is never 0
+
+typedef struct ZoneDatabaseReader {     // one cache line per reader, so announces of readers do not contend
+    uint32_t epoch;         // global epoch seen on enter, READER_INACTIVE outside of read section
+    uint32_t isUsed;
+    uint8_t padding[CACHE_LINE_SIZE - 2 * sizeof(uint32_t)];
+} ZoneDatabaseReader;
+
+static ZoneDatabase *currentDatabase = NULL;
+static uint32_t globalEpoch = 1;
+static uint32_t lastVersion = 0;
+static ZoneDatabase *retiredDatabases = NULL;   // accessed by writer only
+static ZoneDatabaseReader readers[ZONE_DATABASE_MAX_READERS];
+
+static int compareDatabaseZones(const void *first, const void *second);
+static bool isDatabaseReachable(const ZoneDatabase *database);
+
+
+ZoneDatabase *loadZoneDatabase(const char *directory, const char *const *zoneIds, uint16_t zoneCount) {
+    zoneCount = (zoneIds != NULL) ? zoneCount : getTimeZoneCount();
+    ZoneDatabase *database = malloc(sizeof(ZoneDatabase) + zoneCount * sizeof(const TimeZone *));
+    if (database == NULL) return NULL;
+
+    database->version = 0;
+    database->retiredEpoch = 0;
+    database->nextRetired = NULL;
+    database->zoneCount = 0;
+    for (uint16_t i = 0; i < zoneCount; i++) {
+        const char *zoneId = (zoneIds != NULL) ? zoneIds[i] : getTimeZoneByIndex(i)->id;
+        const TimeZone *zone = readTimeZone(directory, zoneId);
+        if (zone != NULL) {
+            database->zones[database->zoneCount++] = zone;
+        }
+    }
+    if (database->zoneCount == 0) {
+        free(database);
+        return NULL;
+    }
+    qsort(database->zones, database->zoneCount, sizeof(const TimeZone *), compareDatabaseZones);
+    return database;
+}
+
+void freeZoneDatabase(ZoneDatabase *database) {
+    if (database == NULL) return;
+    for (uint16_t i = 0; i < database->zoneCount; i++) {
+        freeTimeZone(database->zones[i]);
+    }
+    free(database);
+}
+
+uint32_t publishZoneDatabase(ZoneDatabase *database) {
+    if (database != NULL) {
+        lastVersion++;
+        database->version = lastVersion;
+    }
+    ZoneDatabase *previous = __atomic_exchange_n(&currentDatabase, database, __ATOMIC_SEQ_CST);
+    uint32_t epoch = __atomic_add_fetch(&globalEpoch, 1, __ATOMIC_SEQ_CST);
+    if (epoch == READER_INACTIVE) {     // skip inactive value on wrap around
+        epoch = __atomic_add_fetch(&globalEpoch, 1, __ATOMIC_SEQ_CST);
+    }
+
+    if (previous != NULL) {     // readers that enter since this epoch can't see previous database
+        previous->retiredEpoch = epoch;
+        previous->nextRetired = retiredDatabases;
+        retiredDatabases = previous;
+    }
+    reclaimZoneDatabases();
+    return database != NULL ? database->version : 0;
+}
+
+uint16_t reclaimZoneDatabases() {
+    uint16_t pendingCount = 0;
+    ZoneDatabase **link = &retiredDatabases;
+    while (*link != NULL) {
+        ZoneDatabase *database = *link;
+        if (isDatabaseReachable(database)) {
+            pendingCount++;
+            link = &database->nextRetired;
+        } else {
+            *link = database->nextRetired;
+            freeZoneDatabase(database);
+        }
+    }
+    return pendingCount;
+}
+
+int32_t registerZoneDatabaseReader() {
+    for (int32_t i = 0; i < ZONE_DATABASE_MAX_READERS; i++) {
+        uint32_t isUsed = false;
+        if (__atomic_compare_exchange_n(&readers[i].isUsed, &isUsed, true, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            __atomic_store_n(&readers[i].epoch, READER_INACTIVE, __ATOMIC_RELEASE);
+            return i;
+        }
+    }
+    return ZONE_DATABASE_NO_READER;
+}
+
+void unregisterZoneDatabaseReader(int32_t reader) {
+    if (reader < 0 || reader >= ZONE_DATABASE_MAX_READERS) return;
+    __atomic_store_n(&readers[reader].epoch, READER_INACTIVE, __ATOMIC_RELEASE);
+    __atomic_store_n(&readers[reader].isUsed, false, __ATOMIC_RELEASE);
+}
+
+const ZoneDatabase *enterZoneDatabase(int32_t reader) {
+    if (reader < 0 || reader >= ZONE_DATABASE_MAX_READERS) return NULL;
+    uint32_t epoch = __atomic_load_n(&globalEpoch, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&readers[reader].epoch, epoch, __ATOMIC_SEQ_CST);     // announce before database is read
+    return __atomic_load_n(&currentDatabase, __ATOMIC_SEQ_CST);
+}
+
+void leaveZoneDatabase(int32_t reader) {
+    if (reader < 0 || reader >= ZONE_DATABASE_MAX_READERS) return;
+    __atomic_store_n(&readers[reader].epoch, READER_INACTIVE, __ATOMIC_RELEASE);
+}
+
+const TimeZone *findDatabaseTimeZone(const ZoneDatabase *database, const char *zoneId) {
+    if (database == NULL || zoneId == NULL) return NULL;
+    int32_t low = 0;
+    int32_t high = database->zoneCount - 1;
+    while (low <= high) {
+        int32_t middle = (low + high) / 2;
+        int result = strcmp(database->zones[middle]->id, zoneId);
+        if (result < 0) {
+            low = middle + 1;
+        } else if (result > 0) {
+            high = middle - 1;
+        } else {
+            return database->zones[middle];
+        }
+    }
+    return NULL;
+}
+
+static int compareDatabaseZones(const void *first, const void *second) {
+    return strcmp((*(const TimeZone *const *) first)->id, (*(const TimeZone *const *) second)->id);
+}
+
+/* Reader that entered before the retire epoch could load database pointer before it was replaced*/
+static bool isDatabaseReachable(const ZoneDatabase *database) {
+    for (int32_t i = 0; i < ZONE_DATABASE_MAX_READERS; i++) {
+        uint32_t epoch = __atomic_load_n(&readers[i].epoch, __ATOMIC_SEQ_CST);
+        if (epoch != READER_INACTIVE && (int32_t) (epoch - database->retiredEpoch) < 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif
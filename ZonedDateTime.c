@@ -5,15 +5,19 @@
 static const ZonedDateTime UNINITIALIZED_ZONED_DATE_TIME = {
         .dateTime.date = {.year = 0, .month = 0, .day = 0},
         .dateTime.time = {.hours = -1, .minutes = -1, .seconds = -1, .millis = -1},
-        .zone = {.id = NULL}};
+        .zone = ZONE_HANDLE_NONE};
 
+static void setZonedDateTimeZone(ZonedDateTime *zonedDateTime, const TimeZone *zone);
+static const TimeZone *resolveZonedDateTimeZone(const ZonedDateTime *zonedDateTime, TimeZone *fixedZone);
 static ZonedDateTime *setLocalZoneDateTime(ZonedDateTime *zonedDateTime);
+static ZonedDateTime *setLocalZoneDateTimeWithRules(ZonedDateTime *zonedDateTime, const TimeZone *zone, const LocalZoneRules *localRules);
 
 
 ZonedDateTime zonedDateTimeOf(int64_t year, Month month, uint8_t dayOfMonth, uint8_t hours, uint8_t minutes, uint8_t seconds, uint16_t millis, const TimeZone *zone) {
     DateTime dateTime = dateTimeOfWithMillis(year, month, dayOfMonth, hours, minutes, seconds, millis);
-    ZonedDateTime zonedDateTime = {.dateTime = dateTime, .zone = *zone};
-    setLocalZoneDateTime(&zonedDateTime);
+    ZonedDateTime zonedDateTime = {.dateTime = dateTime};
+    setZonedDateTimeZone(&zonedDateTime, zone);
+    setLocalZoneDateTimeWithRules(&zonedDateTime, zone, NULL);
     return zonedDateTime;
 }
 
@@ -22,8 +26,8 @@ ZonedDateTime zonedDateTimeFrom(Date *date, Time *time, const TimeZone *zone) {
     if (isDateValid(date) && isTimeValid(time) && zone != NULL && zone->id != NULL) {
         DateTime dateTime = {.date = *date, .time = *time};
         zonedDateTime.dateTime = dateTime;
-        zonedDateTime.zone = *zone;
-        setLocalZoneDateTime(&zonedDateTime);
+        setZonedDateTimeZone(&zonedDateTime, zone);
+        setLocalZoneDateTimeWithRules(&zonedDateTime, zone, NULL);
     }
     return zonedDateTime;
 }
@@ -32,19 +36,48 @@ ZonedDateTime zonedDateTimeOfDateTime(DateTime *dateTime, const TimeZone *zone)
     ZonedDateTime zonedDateTime = UNINITIALIZED_ZONED_DATE_TIME;
     if (isDateTimeValid(dateTime) && zone != NULL && zone->id != NULL) {
         zonedDateTime.dateTime = *dateTime;
-        zonedDateTime.zone = *zone;
-        setLocalZoneDateTime(&zonedDateTime);
+        setZonedDateTimeZone(&zonedDateTime, zone);
+        setLocalZoneDateTimeWithRules(&zonedDateTime, zone, NULL);
+    }
+    return zonedDateTime;
+}
+
+ZonedDateTime zonedDateTimeOfDateTimeWithRules(DateTime *dateTime, const TimeZone *zone, const LocalZoneRules *localRules) {
+    ZonedDateTime zonedDateTime = UNINITIALIZED_ZONED_DATE_TIME;
+    if (isDateTimeValid(dateTime) && zone != NULL && zone->id != NULL) {
+        zonedDateTime.dateTime = *dateTime;
+        setZonedDateTimeZone(&zonedDateTime, zone);
+        setLocalZoneDateTimeWithRules(&zonedDateTime, zone, localRules);
+    }
+    return zonedDateTime;
+}
+
+ZonedDateTime zonedDateTimeOfDateTimeWithOffset(DateTime *dateTime, const TimeZone *zone, int32_t offset) {
+    ZonedDateTime zonedDateTime = UNINITIALIZED_ZONED_DATE_TIME;
+    if (isDateTimeValid(dateTime) && zone != NULL && zone->id != NULL) {
+        LocalZoneOffsets localOffsets = resolveLocalZoneOffsets(dateTimeToEpochSecond(dateTime, UTC_OFFSET), NULL, zone);
+        bool isValidOffset = (localOffsets.offsetCount >= 1 && localOffsets.offsets[0] == offset) ||
+                             (localOffsets.offsetCount == 2 && localOffsets.offsets[1] == offset);
+        if (isValidOffset) {    // no valid offsets in gap
+            zonedDateTime.dateTime = *dateTime;
+            zonedDateTime.offset = offset;
+            setZonedDateTimeZone(&zonedDateTime, zone);
+        }
     }
     return zonedDateTime;
 }
 
 ZonedDateTime zonedDateTimeOfInstant(Instant *instant, const TimeZone *zone) {
+    return zonedDateTimeOfInstantCached(instant, zone, NULL);
+}
+
+ZonedDateTime zonedDateTimeOfInstantCached(Instant *instant, const TimeZone *zone, ZoneTransitionCache *cache) {
     ZonedDateTime zonedDateTime = UNINITIALIZED_ZONED_DATE_TIME;
     if (instant != NULL && zone != NULL && zone->id != NULL) {
         DateTime dateTime = dateTimeOfEpochSeconds(instant->seconds, instant->micros, UTC_OFFSET);
         zonedDateTime.dateTime = dateTime;
-        zonedDateTime.zone = *zone;
-        setLocalZoneDateTime(&zonedDateTime);
+        setZonedDateTimeZone(&zonedDateTime, zone);
+        zonedDateTime.offset = resolveTimeZoneOffsetCached(cache, instant->seconds, zone);
     }
     return zonedDateTime;
 }
@@ -55,7 +88,9 @@ ZonedDateTime zonedDateTimeWithSameInstant(ZonedDateTime *zonedDateTime, const T
         int32_t newZoneOffset = resolveTimeZoneOffset(epochSeconds, zone);
         int64_t micros = (zonedDateTime->dateTime.time.millis * MICROS_PER_MILLIS);
         DateTime dateTimeNew = dateTimeOfEpochSeconds(epochSeconds, micros, newZoneOffset);
-        return (ZonedDateTime){.dateTime = dateTimeNew, .offset = newZoneOffset, .zone = *zone};
+        ZonedDateTime zonedDateTimeNew = {.dateTime = dateTimeNew, .offset = newZoneOffset};
+        setZonedDateTimeZone(&zonedDateTimeNew, zone);
+        return zonedDateTimeNew;
     }
     return UNINITIALIZED_ZONED_DATE_TIME;
 }
@@ -136,24 +171,39 @@ bool isZonedDateTimeEquals(ZonedDateTime *zonedDateTime, ZonedDateTime *other) {
     if (zonedDateTime == NULL || other == NULL) return false;
     return isDateTimeEquals(&zonedDateTime->dateTime, &other->dateTime) &&
            zonedDateTime->offset == other->offset &&
-           isTimeZoneEquals(&zonedDateTime->zone, &other->zone);
+           isZoneHandleEquals(zonedDateTime->zone, zonedDateTime->externalZone, other->zone, other->externalZone);
+}
+
+TimeZone getZonedDateTimeZone(const ZonedDateTime *zonedDateTime) {
+    TimeZone fixedZone = {.id = NULL};
+    const TimeZone *zone = resolveZonedDateTimeZone(zonedDateTime, &fixedZone);
+    return zone != NULL ? *zone : fixedZone;
+}
+
+static void setZonedDateTimeZone(ZonedDateTime *zonedDateTime, const TimeZone *zone) {
+    zonedDateTime->zone = zoneHandleOf(zone);
+    zonedDateTime->externalZone = (zonedDateTime->zone == ZONE_HANDLE_EXTERNAL) ? zone : NULL;
+}
+
+static const TimeZone *resolveZonedDateTimeZone(const ZonedDateTime *zonedDateTime, TimeZone *fixedZone) {
+    return resolveZoneHandle(zonedDateTime->zone, zonedDateTime->externalZone, zonedDateTime->offset, fixedZone);
 }
 
 static ZonedDateTime *setLocalZoneDateTime(ZonedDateTime *zonedDateTime) {
-    int64_t epochSeconds = dateTimeToEpochSecond(&zonedDateTime->dateTime, UTC_OFFSET);
-
-    int32_t storedOffset = zonedDateTime->zone.utcOffset;
-    ZoneTransition zoneTransition = findZoneRuleTransition(epochSeconds, &zonedDateTime->zone);
-    if (zoneTransition.after != NULL && zoneTransition.before != NULL) {
-        storedOffset = isTransitionGap(&zoneTransition, epochSeconds) ? zoneTransition.after->gmtOffset : zoneTransition.before->gmtOffset;
-
-        uint32_t gapStartDate = zoneTransition.before->transition + zoneTransition.after->gmtOffset;
-        uint32_t gapEndDate = gapStartDate + zoneTransition.after->gmtOffset;
-        bool isLocalDateInTimeGap = (epochSeconds >= gapStartDate) && (epochSeconds < gapEndDate);
-        if (isLocalDateInTimeGap) {
-            dateTimePlusSeconds(&zonedDateTime->dateTime, zoneTransition.after->gmtOffset);
-        }
+    TimeZone fixedZone;
+    const TimeZone *zone = resolveZonedDateTimeZone(zonedDateTime, &fixedZone);
+    return setLocalZoneDateTimeWithRules(zonedDateTime, zone, NULL);
+}
+
+static ZonedDateTime *setLocalZoneDateTimeWithRules(ZonedDateTime *zonedDateTime, const TimeZone *zone, const LocalZoneRules *localRules) {
+    if (zone == NULL) return zonedDateTime;     // uninitialized zone, date-time is kept as is
+    int64_t localEpochSeconds = dateTimeToEpochSecond(&zonedDateTime->dateTime, UTC_OFFSET);
+    LocalZoneOffsets localOffsets = resolveLocalZoneOffsets(localEpochSeconds, localRules, zone);
+    if (localOffsets.offsetCount == 0) {    // local date-time in gap is moved forward by the gap length
+        dateTimePlusSeconds(&zonedDateTime->dateTime, localOffsets.offsets[1] - localOffsets.offsets[0]);
+        zonedDateTime->offset = localOffsets.offsets[1];
+    } else {
+        zonedDateTime->offset = localOffsets.offsets[0];    // earlier offset is kept in overlap
     }
-    zonedDateTime->offset = storedOffset;
     return zonedDateTime;
 }
\ No newline at end of file
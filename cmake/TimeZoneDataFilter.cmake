@@ -0,0 +1,162 @@
+# Generates reduced copy of TimeZoneData.c at configure time.
+#  GDT_RULES_FROM_YEAR, GDT_RULES_TO_YEAR - keeps only rule transitions inside the year window and the last transition
+#  before it, so offsets inside the window are not changed. Recurring rules are still used after the last transition.
+#  GDT_ZONES - keeps only listed zones (separated by ";" or ",") in ZONE_LIST and rule tables referenced by them.
+#  "UTC" and "GMT" are accepted, they are not ZONE_LIST entries and are always compiled.
+
+# Days from 1970-01-01 to January 1 of provided year, proleptic Gregorian calendar
+function(gdt_epoch_day_of_year year outVar)
+    math(EXPR y "${year} - 1")
+    if (y GREATER_EQUAL 0)
+        math(EXPR era "${y} / 400")
+    else ()
+        math(EXPR era "(${y} - 399) / 400")
+    endif ()
+    math(EXPR yearOfEra "${y} - ${era} * 400")
+    math(EXPR dayOfEra "${yearOfEra} * 365 + ${yearOfEra} / 4 - ${yearOfEra} / 100 + 306")
+    math(EXPR epochDay "${era} * 146097 + ${dayOfEra} - 719468")
+    set(${outVar} ${epochDay} PARENT_SCOPE)
+endfunction()
+
+function(gdt_filter_time_zone_data sourceFile outputFile)
+    file(READ ${sourceFile} content)
+    string(REPLACE ";" "<semicolon>" content "${content}")     # keep lines as CMake list items
+    string(REPLACE "[" "<bracket>" content "${content}")
+    string(REPLACE "]" "</bracket>" content "${content}")
+    string(REPLACE "\n" ";" lines "${content}")
+
+    string(REPLACE "," ";" zones "${GDT_ZONES}")     # comma is easier to pass through package managers
+    set(fromEpoch "")
+    set(toEpoch "")
+    if (NOT "${GDT_RULES_FROM_YEAR}" STREQUAL "")
+        gdt_epoch_day_of_year(${GDT_RULES_FROM_YEAR} epochDay)
+        math(EXPR fromEpoch "${epochDay} * 86400")
+    endif ()
+    if (NOT "${GDT_RULES_TO_YEAR}" STREQUAL "")
+        math(EXPR nextYear "${GDT_RULES_TO_YEAR} + 1")
+        gdt_epoch_day_of_year(${nextYear} epochDay)
+        math(EXPR toEpoch "${epochDay} * 86400")
+    endif ()
+
+    set(zoneIds "")         # all ZONE_LIST ids in order
+    set(linkIndexes "")
+    set(keptZoneIds "")
+    set(keptRules "")
+    set(isLinkTable FALSE)
+    foreach (line IN LISTS lines)
+        if (line MATCHES "^        {\\.id = \"([^\"]+)\"")
+            list(APPEND zoneIds ${CMAKE_MATCH_1})
+            list(FIND zones ${CMAKE_MATCH_1} zoneIndex)
+            if (NOT zoneIndex EQUAL -1)
+                list(APPEND keptZoneIds ${CMAKE_MATCH_1})
+                if (line MATCHES "\\.rules = ([A-Z0-9_]+)")
+                    list(APPEND keptRules ${CMAKE_MATCH_1})
+                endif ()
+            endif ()
+        elseif (line MATCHES "^const uint16_t ZONE_LINK_INDEXES")
+            set(isLinkTable TRUE)
+        elseif (isLinkTable AND line MATCHES "^}")
+            set(isLinkTable FALSE)
+        elseif (isLinkTable)
+            string(REGEX MATCHALL "[0-9]+" indexes "${line}")
+            list(APPEND linkIndexes ${indexes})
+        endif ()
+    endforeach ()
+
+    if (GDT_ZONES)
+        foreach (zoneId IN LISTS zones)
+            list(FIND keptZoneIds ${zoneId} zoneIndex)
+            if (zoneIndex EQUAL -1 AND NOT zoneId STREQUAL "UTC" AND NOT zoneId STREQUAL "GMT")
+                message(FATAL_ERROR "GDT_ZONES: unknown zone id '${zoneId}'")
+            endif ()
+        endforeach ()
+    endif ()
+
+    set(output "")
+    set(skipRuleTable FALSE)
+    set(skipEmptyLine FALSE)
+    set(pendingRule "")
+    foreach (line IN LISTS lines)
+        if (line MATCHES "^const TimeZoneRule ([A-Z0-9_]+)<bracket></bracket> = {")
+            list(FIND keptRules ${CMAKE_MATCH_1} ruleIndex)
+            set(skipRuleTable FALSE)
+            if (GDT_ZONES AND ruleIndex EQUAL -1)
+                set(skipRuleTable TRUE)
+            endif ()
+        endif ()
+
+        if (skipRuleTable)
+            if (line MATCHES "^  {\\.transition = 0}}<semicolon>$")
+                set(skipRuleTable FALSE)
+                set(skipEmptyLine TRUE)
+            endif ()
+            continue()
+        endif ()
+        if (skipEmptyLine)
+            set(skipEmptyLine FALSE)
+            if (line STREQUAL "")
+                continue()
+            endif ()
+        endif ()
+
+        if (line MATCHES "^  {\\.gmtOffset = .*\\.transition = (-?[0-9]+)}")
+            set(transition ${CMAKE_MATCH_1})
+            if (NOT fromEpoch STREQUAL "" AND transition LESS fromEpoch)
+                set(pendingRule "${line}")      # last rule before window defines offset at window start
+                continue()
+            endif ()
+            if (NOT pendingRule STREQUAL "")
+                list(APPEND output "${pendingRule}")
+                set(pendingRule "")
+            endif ()
+            if (NOT toEpoch STREQUAL "" AND transition GREATER_EQUAL toEpoch)
+                continue()
+            endif ()
+        elseif (NOT pendingRule STREQUAL "")  # all rules are before window
+            list(APPEND output "${pendingRule}")
+            set(pendingRule "")
+        endif ()
+
+        if (GDT_ZONES AND line MATCHES "^        {\\.id = \"([^\"]+)\"")
+            list(FIND keptZoneIds ${CMAKE_MATCH_1} zoneIndex)
+            if (zoneIndex EQUAL -1)
+                continue()
+            endif ()
+        endif ()
+
+        if (GDT_ZONES AND line MATCHES "^const uint16_t ZONE_LINK_INDEXES")
+            list(APPEND output "${line}")
+            set(keptLinkIndexes "")
+            foreach (zoneId IN LISTS keptZoneIds)   # alias without kept link target becomes canonical
+                list(FIND zoneIds ${zoneId} zoneIndex)
+                list(GET linkIndexes ${zoneIndex} linkIndex)
+                list(GET zoneIds ${linkIndex} linkZoneId)
+                list(FIND keptZoneIds ${linkZoneId} keptLinkIndex)
+                if (keptLinkIndex EQUAL -1)
+                    list(FIND keptZoneIds ${zoneId} keptLinkIndex)
+                endif ()
+                list(APPEND keptLinkIndexes ${keptLinkIndex})
+            endforeach ()
+            string(REPLACE ";" ", " keptLinkIndexes "${keptLinkIndexes}")
+            list(APPEND output "        ${keptLinkIndexes}")
+            set(isLinkTable TRUE)
+            continue()
+        endif ()
+        if (isLinkTable)
+            if (NOT line MATCHES "^}")
+                continue()
+            endif ()
+            set(isLinkTable FALSE)
+        endif ()
+
+        list(APPEND output "${line}")
+    endforeach ()
+
+    string(REPLACE ";" "\n" content "${output}")
+    string(REPLACE "<semicolon>" ";" content "${content}")
+    string(REPLACE "<bracket>" "[" content "${content}")
+    string(REPLACE "</bracket>" "]" content "${content}")
+    file(WRITE ${outputFile}.tmp "${content}")
+    configure_file(${outputFile}.tmp ${outputFile} COPYONLY)    # keeps timestamp when content is not changed
+    file(REMOVE ${outputFile}.tmp)
+endfunction()
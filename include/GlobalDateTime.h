@@ -6,6 +6,10 @@
 #include <limits.h>
 
 #include "ZonedDateTime.h"
+#include "TimeZoneLoader.h"
+#include "ZoneDatabase.h"
+#include "TimeZoneOffsetTable.h"
+#include "TimeZoneRulesCache.h"
 
 #define DATE_TIME_FORMAT_SIZE 64
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stddef.h>
+
 #include "LocalTime.h"
 
 /*The number of days in a 400 year cycle.*/
@@ -48,6 +50,21 @@ typedef struct Date {
     DayOfWeek weekDay;
 } Date;
 
+typedef enum DateBatchKernel {
+    DATE_BATCH_SCALAR,
+    DATE_BATCH_AVX2,        // x86 with AVX2, eight days per step
+    DATE_BATCH_AVX512       // x86 with AVX-512F, sixteen days per step
+} DateBatchKernel;
+
+/* Date packed to 32 bits: biased year (23 bits), month (4 bits) and day (5 bits) from the most significant bits,
+ * so integer compare is chronological compare. Week day is not stored, years out of packed range can't be packed*/
+typedef uint32_t PackedDate;
+
+#define PACKED_DATE_INVALID 0                           // month 0 is never packed
+#define PACKED_DATE_YEAR_BIAS (1L << 22)
+#define PACKED_DATE_MIN_YEAR (-PACKED_DATE_YEAR_BIAS)     // -4194304
+#define PACKED_DATE_MAX_YEAR (PACKED_DATE_YEAR_BIAS - 1)  // 4194303
+
 /* Obtains the current date from the hardware clock. Should be implemented on the driver side*/
 extern Date dateNow();
 
@@ -62,6 +79,22 @@ Date dateOf(int64_t year, Month month, uint8_t dayOfMonth);
  *  epochDay – the Epoch Day to convert, based on the epoch 1970-01-01*/
 Date dateOfEpochDay(int64_t epochDay);
 
+/* Detects the fastest batch conversion kernel supported by CPU, scalar on targets without SIMD kernels*/
+DateBatchKernel detectDateBatchKernel();
+
+/* Converts epoch days to dates written as structure of arrays, such as columnar export of day columns.
+ * Each result is the same as dateOfEpochDay() of the day, 32-bit epoch day is always valid. No Date structure
+ * is created, so conversion costs a few multiplies per day. SIMD kernel is detected on first call.
+ * Params:
+ *  epochDays – the epoch days to convert
+ *  count – the count of epoch days and length of each output array
+ *  years, months, days, weekDays – the output arrays for year, Month, day of month and DayOfWeek of each day*/
+void dateOfEpochDayBatch(const int32_t *epochDays, size_t count, int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays);
+
+/* Same as dateOfEpochDayBatch() with provided kernel, kernel not supported by CPU is lowered to detected one*/
+void dateOfEpochDayBatchWithKernel(DateBatchKernel kernel, const int32_t *epochDays, size_t count,
+                                   int32_t *years, uint8_t *months, uint8_t *days, uint8_t *weekDays);
+
 /* Return initialized Date structure from a year and day-of-year.
  * The result is initialized Date with the specified year and day-of-year. The day-of-year must be valid for the year.
  * Params:
@@ -78,6 +111,15 @@ Date dateOfYearDay(uint32_t year, uint32_t dayOfYear);
  *  zone – the time-zone, which may be an gmtOffset*/
 Date dateOfInstant(Instant *instant, const TimeZone *zone);
 
+/* Packs date to 32 bit value, such as for compact tables, sorting and hashing of dates.
+ * Params:
+ *  date – the date to pack, year should be from PACKED_DATE_MIN_YEAR to PACKED_DATE_MAX_YEAR
+ * Returns: packed date, PACKED_DATE_INVALID for invalid date or year out of packed range*/
+PackedDate packDate(const Date *date);
+
+/* Returns date of packed value with week day restored, invalid date for PACKED_DATE_INVALID or corrupted value*/
+Date unpackDate(PackedDate packedDate);
+
 /* Converts Date to the Epoch Day.
  * The Epoch Day count is a simple incrementing count of days where day 0 is 1970-01-01 (ISO). This definition is the same for all chronologies, enabling conversion.
  * Returns: the Epoch Day equivalent to this date*/
@@ -261,10 +303,31 @@ uint16_t getLengthOfYear(int64_t year);
  * The calculation is proleptic - applying the same rules into the far future and far past. This is historically inaccurate, but is correct for the ISO-8601 standard.
  * Returns:
  * true if the year is leap, false otherwise*/
-bool isLeapYear(int64_t year);
+static inline bool isLeapYear(int64_t year) {
+    // branch free: divisible by 4, or by 16 when divisible by 25, divisible by 16 and 25 is divisible by 400
+    return (year & (3 + 12 * (year % 25 == 0))) == 0;
+}
+
+/* Month metadata indexed by [leap year][month], month zero is outside of MONTH_OF_YEAR_RANGE*/
+static const int8_t MONTH_LENGTH[2][13] = {
+        {-1, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+        {-1, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}
+};
+static const uint16_t FIRST_DAY_OF_YEAR_BY_MONTH[2][13] = {
+        {335, 1, 32, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335},
+        {336, 1, 32, 61, 92, 122, 153, 183, 214, 245, 275, 306, 336}
+};
+
+/* Returns day of year of the first day of month, month out of range is resolved as December*/
+static inline uint32_t firstDayOfYearByMonth(Month month, bool leapYear) {
+    return FIRST_DAY_OF_YEAR_BY_MONTH[leapYear][((uint32_t) month <= DECEMBER) ? month : DECEMBER];
+}
+
+/* Returns day count of month, -1 for month out of range*/
+static inline int8_t lengthOfMonth(Month month, bool leapYear) {
+    return ((uint32_t) month <= DECEMBER) ? MONTH_LENGTH[leapYear][month] : -1;
+}
 
-uint32_t firstDayOfYearByMonth(Month month, bool leapYear);
-int8_t lengthOfMonth(Month month, bool leapYear);
 bool isDateValid(const Date *date);
 
 
@@ -10,6 +10,14 @@ typedef struct DateTime {
 } DateTime;
 
 
+/* Date-time packed to 64 bits with millisecond precision: biased year (28 bits), month (4 bits), day (5 bits),
+ * hours (5 bits), minutes (6 bits), seconds (6 bits) and millis (10 bits) from the most significant bits.
+ * Integer compare is chronological compare, packed range covers YEAR_RANGE*/
+typedef uint64_t PackedDateTime;
+
+#define PACKED_DATE_TIME_INVALID 0      // month 0 is never packed
+#define PACKED_DATE_TIME_YEAR_BIAS (1LL << 27)
+
 /* Obtains the current date and from the hardware clock. Should be implemented on the driver side*/
 extern DateTime dateTimeNow();
 
@@ -277,4 +285,11 @@ bool isDateTimeBetween(DateTime *dateTime, DateTime *startExclusive, DateTime *e
  * Returns: true if provided is equal to the other date-time*/
 bool isDateTimeEquals(DateTime *dateTime, DateTime *other);
 
-bool isDateTimeValid(DateTime *dateTime);
\ No newline at end of file
+bool isDateTimeValid(DateTime *dateTime);
+
+/* Packs date-time to 64 bit value, such as for compact tables, sorting and hashing of date-times.
+ * Returns: packed date-time, PACKED_DATE_TIME_INVALID for invalid date-time*/
+PackedDateTime packDateTime(const DateTime *dateTime);
+
+/* Returns date-time of packed value with week day restored, invalid date-time for PACKED_DATE_TIME_INVALID or corrupted value*/
+DateTime unpackDateTime(PackedDateTime packedDateTime);
\ No newline at end of file
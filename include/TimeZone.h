@@ -12,6 +12,8 @@ typedef struct TimeZone {
     int32_t utcOffset;   // in seconds
     const char *const *names;
     const TimeZoneRule *rules;
+    uint16_t ruleCount;  // number of rules without terminating entry, 0 if unknown
+    const ZoneRecurringRule *recurringRule;  // rule for instants after the last transition, NULL if none
 } TimeZone;
 
 typedef struct ZoneTransition {
@@ -19,575 +21,306 @@ typedef struct ZoneTransition {
     const TimeZoneRule *after;
 } ZoneTransition;
 
+/* Valid offsets for a local date-time, such as the single offset, two offsets in overlap or none in gap*/
+typedef struct LocalZoneOffsets {
+    int32_t offsets[2];     // valid offsets with the earlier first, in gap offsets before and after transition
+    uint8_t offsetCount;    // 1 - normal, 2 - overlap, 0 - gap
+    int64_t transition;     // transition epoch seconds of gap or overlap
+} LocalZoneOffsets;
+
+/* Remembers the last found transition window, so nearly sorted epoch seconds of the same zone are resolved in O(1).
+ * Rules are stored by value, so windows calculated from zone recurring rule are reused as well.
+ * Should be zero initialized, not thread safe, so each thread should own its cache*/
+typedef struct ZoneTransitionCache {
+    const TimeZoneRule *rules;                  // rules and recurring rule of cached zone
+    const ZoneRecurringRule *recurringRule;
+    TimeZoneRule before;
+    TimeZoneRule after;
+    int64_t validFrom;      // window applies to epoch seconds after 'validFrom' up to 'after' transition
+    bool hasTransition;     // false until the first found window
+    bool isRecurring;       // window is calculated from recurring rule
+    uint64_t hits;
+    uint64_t misses;
+} ZoneTransitionCache;
+
+/* Compact zone reference, such as stored in ZonedDateTime instead of TimeZone copy, so zone equality is integer compare.
+ * Handle is ZONE_LIST index, fixed offset "UTC" or "GMT" zone, or ZONE_HANDLE_EXTERNAL for zone outside ZONE_LIST.
+ * Offset of fixed offset zone and pointer of external zone are not part of handle and should be stored along with it*/
+typedef uint16_t ZoneHandle;
+
+#define ZONE_HANDLE_NONE            UINT16_MAX          // no zone, such as in uninitialized zoned date-time
+#define ZONE_HANDLE_FIXED_UTC       (UINT16_MAX - 1)    // "UTC" with fixed offset, such as parsed "+02:00"
+#define ZONE_HANDLE_FIXED_GMT       (UINT16_MAX - 2)    // "GMT" with fixed offset, such as parsed "GMT+02:00"
+#define ZONE_HANDLE_EXTERNAL        (UINT16_MAX - 3)    // zone outside ZONE_LIST, such as loaded or custom zone
+
+#define ZONE_YEAR_CACHE_SIZE 4          // cached years of one zone
+#define ZONE_YEAR_MAX_SEGMENTS 3        // two transitions in year, such as daylight time start and end
+
+/* Zone rules pair that applies to epoch seconds up to and including 'lastEpochSecond'*/
+typedef struct ZoneYearSegment {
+    int64_t lastEpochSecond;
+    TimeZoneRule before;
+    TimeZoneRule after;
+    bool hasTransition;     // false when zone utcOffset applies, such as after the last rule without recurring rule
+} ZoneYearSegment;
+
+/* Zone rules of one UTC year, 'segmentCount' is 0 when year has more transitions than can be cached*/
+typedef struct ZoneYearEntry {
+    int64_t firstEpochSecond;
+    int64_t lastEpochSecond;
+    ZoneYearSegment segments[ZONE_YEAR_MAX_SEGMENTS];
+    uint8_t segmentCount;
+} ZoneYearEntry;
+
+/* Keeps zone rules of recently used years of one zone, so offset lookup costs the same for any rule history depth.
+ * Years are filled on first lookup from zone rules or recurring rule, the oldest filled year is replaced first.
+ * Should be zero initialized, not thread safe, so each thread should own its cache*/
+typedef struct ZoneYearCache {
+    const TimeZone *zone;
+    ZoneYearEntry entries[ZONE_YEAR_CACHE_SIZE];
+    uint8_t entryCount;
+    uint8_t nextEntryIndex;
+    uint64_t hits;
+    uint64_t misses;
+} ZoneYearCache;
+
+typedef struct ZoneOffsetEntry {
+    int32_t offset;         // in seconds
+    uint16_t zoneIndex;     // index in ZONE_LIST
+} ZoneOffsetEntry;
+
+/* All ZONE_LIST zones sorted by offset at some instant, such as for finding zones with local time 09:00.
+ * Snapshot stays valid until the nearest offset change of any zone, then it is rebuilt on the next query.
+ * Not thread safe, so each thread should own its index*/
+typedef struct ZoneOffsetIndex {
+    ZoneOffsetEntry *entries;   // storage of getTimeZoneCount() length
+    uint16_t entryCount;
+    int64_t validFrom;          // first epoch second of snapshot
+    int64_t validUntil;         // last epoch second of snapshot, less than 'validFrom' before the first query
+} ZoneOffsetIndex;
+
 typedef enum ZoneTextStyle {
     ZONE_NAME_SHORT,
     ZONE_NAME_LONG
 } ZoneTextStyle;
 
-static const TimeZone UTC = {.id = "UTC", .utcOffset = 0, .names = UTC_ZONE_NAMES, .rules = NULL};
-static const TimeZone GMT = {.id = "GMT", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL};
-
-static const TimeZone ZONE_LIST[] = {
-        #ifdef ENABLE_TIME_ZONE_SUPPORT
-        {.id = "Africa/Abidjan", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Accra", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Addis_Ababa", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Algiers", .utcOffset = 3600, .names = CET_ZONE_NAMES, .rules = AFRICA_ALGIERS_RULES},
-        {.id = "Africa/Asmara", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Asmera", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Bamako", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Bangui", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Banjul", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Bissau", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_BISSAU_RULES},
-        {.id = "Africa/Blantyre", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Brazzaville", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Bujumbura", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Cairo", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = AFRICA_CAIRO_RULES},
-        {.id = "Africa/Casablanca", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = AFRICA_CASABLANCA_RULES},
-        {.id = "Africa/Ceuta", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = AFRICA_CEUTA_RULES},
-        {.id = "Africa/Conakry", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Dakar", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Dar_es_Salaam", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Djibouti", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Douala", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/El_Aaiun", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = AFRICA_EL_AAIUN_RULES},
-        {.id = "Africa/Freetown", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Gaborone", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Harare", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Johannesburg", .utcOffset = 7200, .names = SAST_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Juba", .utcOffset = 7200, .names = EAT_ZONE_NAMES, .rules = AFRICA_JUBA_RULES},
-        {.id = "Africa/Kampala", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Khartoum", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = AFRICA_KHARTOUM_RULES},
-        {.id = "Africa/Kigali", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Kinshasa", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Lagos", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Libreville", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Lome", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Luanda", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Lubumbashi", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Lusaka", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Malabo", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Maputo", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Maseru", .utcOffset = 7200, .names = SAST_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Mbabane", .utcOffset = 7200, .names = SAST_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Mogadishu", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Monrovia", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_MONROVIA_RULES},
-        {.id = "Africa/Nairobi", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Ndjamena", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = AFRICA_NDJAMENA_RULES},
-        {.id = "Africa/Niamey", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Nouakchott", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Ouagadougou", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Porto-Novo", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Sao_Tome", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_SAO_TOME_RULES},
-        {.id = "Africa/Timbuktu", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Tripoli", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = AFRICA_TRIPOLI_RULES},
-        {.id = "Africa/Tunis", .utcOffset = 3600, .names = CET_ZONE_NAMES, .rules = AFRICA_TUNIS_RULES},
-        {.id = "Africa/Windhoek", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = AFRICA_WINDHOEK_RULES},
-        {.id = "America/Adak", .utcOffset = -32400, .names = HST_ZONE_NAMES, .rules = AMERICA_ADAK_RULES},
-        {.id = "America/Anchorage", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_ANCHORAGE_RULES},
-        {.id = "America/Anguilla", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Antigua", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Araguaina", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_ARAGUAINA_RULES},
-        {.id = "America/Argentina/Buenos_Aires", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_BUENOS_AIRES_RULES},
-        {.id = "America/Argentina/Catamarca", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_CATAMARCA_RULES},
-        {.id = "America/Argentina/ComodRivadavia", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Argentina/Cordoba", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_CORDOBA_RULES},
-        {.id = "America/Argentina/Jujuy", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_JUJUY_RULES},
-        {.id = "America/Argentina/La_Rioja", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_LA_RIOJA_RULES},
-        {.id = "America/Argentina/Mendoza", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_MENDOZA_RULES},
-        {.id = "America/Argentina/Rio_Gallegos", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_RIO_GALLEGOS_RULES},
-        {.id = "America/Argentina/Salta", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SALTA_RULES},
-        {.id = "America/Argentina/San_Juan", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SAN_JUAN_RULES},
-        {.id = "America/Argentina/San_Luis", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SAN_LUIS_RULES},
-        {.id = "America/Argentina/Tucuman", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_TUCUMAN_RULES},
-        {.id = "America/Argentina/Ushuaia", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_USHUAIA_RULES},
-        {.id = "America/Aruba", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Asuncion", .utcOffset = -14400, .names = PYT_ZONE_NAMES, .rules = AMERICA_ASUNCION_RULES},
-        {.id = "America/Atikokan", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Atka", .utcOffset = -32400, .names = HST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Bahia", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_BAHIA_RULES},
-        {.id = "America/Bahia_Banderas", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_BAHIA_BANDERAS_RULES},
-        {.id = "America/Barbados", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_BARBADOS_RULES},
-        {.id = "America/Belem", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_BELEM_RULES},
-        {.id = "America/Belize", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_BELIZE_RULES},
-        {.id = "America/Blanc-Sablon", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Boa_Vista", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_BOA_VISTA_RULES},
-        {.id = "America/Bogota", .utcOffset = -18000, .names = COT_ZONE_NAMES, .rules = AMERICA_BOGOTA_RULES},
-        {.id = "America/Boise", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_BOISE_RULES},
-        {.id = "America/Buenos_Aires", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Cambridge_Bay", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_CAMBRIDGE_BAY_RULES},
-        {.id = "America/Campo_Grande", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_CAMPO_GRANDE_RULES},
-        {.id = "America/Cancun", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = AMERICA_CANCUN_RULES},
-        {.id = "America/Caracas", .utcOffset = -14400, .names = VET_ZONE_NAMES, .rules = AMERICA_CARACAS_RULES},
-        {.id = "America/Catamarca", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Cayenne", .utcOffset = -10800, .names = GFT_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Cayman", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Chicago", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_CHICAGO_RULES},
-        {.id = "America/Chihuahua", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_CHIHUAHUA_RULES},
-        {.id = "America/Coral_Harbour", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Cordoba", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Costa_Rica", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_COSTA_RICA_RULES},
-        {.id = "America/Creston", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Cuiaba", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_CUIABA_RULES},
-        {.id = "America/Curacao", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Danmarkshavn", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AMERICA_DANMARKSHAVN_RULES},
-        {.id = "America/Dawson", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_DAWSON_RULES},
-        {.id = "America/Dawson_Creek", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_DAWSON_CREEK_RULES},
-        {.id = "America/Denver", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_DENVER_RULES},
-        {.id = "America/Detroit", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_DETROIT_RULES},
-        {.id = "America/Dominica", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Edmonton", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_EDMONTON_RULES},
-        {.id = "America/Eirunepe", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = AMERICA_EIRUNEPE_RULES},
-        {.id = "America/El_Salvador", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_EL_SALVADOR_RULES},
-        {.id = "America/Ensenada", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Fort_Nelson", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_FORT_NELSON_RULES},
-        {.id = "America/Fort_Wayne", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Fortaleza", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_FORTALEZA_RULES},
-        {.id = "America/Glace_Bay", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_GLACE_BAY_RULES},
-        {.id = "America/Godthab", .utcOffset = -7200, .names = WGT_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Goose_Bay", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_GOOSE_BAY_RULES},
-        {.id = "America/Grand_Turk", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_GRAND_TURK_RULES},
-        {.id = "America/Grenada", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Guadeloupe", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Guatemala", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_GUATEMALA_RULES},
-        {.id = "America/Guayaquil", .utcOffset = -18000, .names = ECT_ZONE_NAMES, .rules = AMERICA_GUAYAQUIL_RULES},
-        {.id = "America/Guyana", .utcOffset = -14400, .names = GYT_ZONE_NAMES, .rules = AMERICA_GUYANA_RULES},
-        {.id = "America/Halifax", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_HALIFAX_RULES},
-        {.id = "America/Havana", .utcOffset = -14400, .names = CST_ZONE_NAMES, .rules = AMERICA_HAVANA_RULES},
-        {.id = "America/Hermosillo", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_HERMOSILLO_RULES},
-        {.id = "America/Indiana/Indianapolis", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_INDIANAPOLIS_RULES},
-        {.id = "America/Indiana/Knox", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_INDIANA_KNOX_RULES},
-        {.id = "America/Indiana/Marengo", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_MARENGO_RULES},
-        {.id = "America/Indiana/Petersburg", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_PETERSBURG_RULES},
-        {.id = "America/Indiana/Tell_City", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_INDIANA_TELL_CITY_RULES},
-        {.id = "America/Indiana/Vevay", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_VEVAY_RULES},
-        {.id = "America/Indiana/Vincennes", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_VINCENNES_RULES},
-        {.id = "America/Indiana/Winamac", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_WINAMAC_RULES},
-        {.id = "America/Indianapolis", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Inuvik", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_INUVIK_RULES},
-        {.id = "America/Iqaluit", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_IQALUIT_RULES},
-        {.id = "America/Jamaica", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = AMERICA_JAMAICA_RULES},
-        {.id = "America/Jujuy", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Juneau", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_JUNEAU_RULES},
-        {.id = "America/Kentucky/Louisville", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_KENTUCKY_LOUISVILLE_RULES},
-        {.id = "America/Kentucky/Monticello", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_KENTUCKY_MONTICELLO_RULES},
-        {.id = "America/Knox_IN", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Kralendijk", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/La_Paz", .utcOffset = -14400, .names = BOT_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Lima", .utcOffset = -18000, .names = PET_ZONE_NAMES, .rules = AMERICA_LIMA_RULES},
-        {.id = "America/Los_Angeles", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_LOS_ANGELES_RULES},
-        {.id = "America/Louisville", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Lower_Princes", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Maceio", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_MACEIO_RULES},
-        {.id = "America/Managua", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_MANAGUA_RULES},
-        {.id = "America/Manaus", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_MANAUS_RULES},
-        {.id = "America/Marigot", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Martinique", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_MARTINIQUE_RULES},
-        {.id = "America/Matamoros", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MATAMOROS_RULES},
-        {.id = "America/Mazatlan", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_MAZATLAN_RULES},
-        {.id = "America/Mendoza", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Menominee", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MENOMINEE_RULES},
-        {.id = "America/Merida", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MERIDA_RULES},
-        {.id = "America/Metlakatla", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_METLAKATLA_RULES},
-        {.id = "America/Mexico_City", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MEXICO_CITY_RULES},
-        {.id = "America/Miquelon", .utcOffset = -7200, .names = PMST_ZONE_NAMES, .rules = AMERICA_MIQUELON_RULES},
-        {.id = "America/Moncton", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_MONCTON_RULES},
-        {.id = "America/Monterrey", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MONTERREY_RULES},
-        {.id = "America/Montevideo", .utcOffset = -10800, .names = UYT_ZONE_NAMES, .rules = AMERICA_MONTEVIDEO_RULES},
-        {.id = "America/Montreal", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Montserrat", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Nassau", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NASSAU_RULES},
-        {.id = "America/New_York", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NEW_YORK_RULES},
-        {.id = "America/Nipigon", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NIPIGON_RULES},
-        {.id = "America/Nome", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_NOME_RULES},
-        {.id = "America/Noronha", .utcOffset = -7200, .names = FNT_ZONE_NAMES, .rules = AMERICA_NORONHA_RULES},
-        {.id = "America/North_Dakota/Beulah", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_BEULAH_RULES},
-        {.id = "America/North_Dakota/Center", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_CENTER_RULES},
-        {.id = "America/North_Dakota/New_Salem", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_NEW_SALEM_RULES},
-        {.id = "America/Nuuk", .utcOffset = -7200, .names = WGT_ZONE_NAMES, .rules = AMERICA_NUUK_RULES},
-        {.id = "America/Ojinaga", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_OJINAGA_RULES},
-        {.id = "America/Panama", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Pangnirtung", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_PANGNIRTUNG_RULES},
-        {.id = "America/Paramaribo", .utcOffset = -10800, .names = SRT_ZONE_NAMES, .rules = AMERICA_PARAMARIBO_RULES},
-        {.id = "America/Phoenix", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Port-au-Prince", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_PORT_AU_PRINCE_RULES},
-        {.id = "America/Port_of_Spain", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Porto_Acre", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Porto_Velho", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_PORTO_VELHO_RULES},
-        {.id = "America/Puerto_Rico", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Punta_Arenas", .utcOffset = -10800, .names = GMT_03_00_ZONE_NAMES, .rules = AMERICA_PUNTA_ARENAS_RULES},
-        {.id = "America/Rainy_River", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RAINY_RIVER_RULES},
-        {.id = "America/Rankin_Inlet", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RANKIN_INLET_RULES},
-        {.id = "America/Recife", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_RECIFE_RULES},
-        {.id = "America/Regina", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Resolute", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RESOLUTE_RULES},
-        {.id = "America/Rio_Branco", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = AMERICA_RIO_BRANCO_RULES},
-        {.id = "America/Rosario", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Santa_Isabel", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Santarem", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_SANTAREM_RULES},
-        {.id = "America/Santiago", .utcOffset = -14400, .names = CLT_ZONE_NAMES, .rules = AMERICA_SANTIAGO_RULES},
-        {.id = "America/Santo_Domingo", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_SANTO_DOMINGO_RULES},
-        {.id = "America/Sao_Paulo", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_SAO_PAULO_RULES},
-        {.id = "America/Scoresbysund", .utcOffset = 0, .names = EGT_ZONE_NAMES, .rules = AMERICA_SCORESBYSUND_RULES},
-        {.id = "America/Shiprock", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Sitka", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_SITKA_RULES},
-        {.id = "America/St_Barthelemy", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/St_Johns", .utcOffset = -9000, .names = NST_ZONE_NAMES, .rules = AMERICA_ST_JOHNS_RULES},
-        {.id = "America/St_Kitts", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/St_Lucia", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/St_Thomas", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/St_Vincent", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Swift_Current", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_SWIFT_CURRENT_RULES},
-        {.id = "America/Tegucigalpa", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_TEGUCIGALPA_RULES},
-        {.id = "America/Thule", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_THULE_RULES},
-        {.id = "America/Thunder_Bay", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_THUNDER_BAY_RULES},
-        {.id = "America/Tijuana", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_TIJUANA_RULES},
-        {.id = "America/Toronto", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_TORONTO_RULES},
-        {.id = "America/Tortola", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Vancouver", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_VANCOUVER_RULES},
-        {.id = "America/Virgin", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Whitehorse", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_WHITEHORSE_RULES},
-        {.id = "America/Winnipeg", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_WINNIPEG_RULES},
-        {.id = "America/Yakutat", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_YAKUTAT_RULES},
-        {.id = "America/Yellowknife", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_YELLOWKNIFE_RULES},
-        {.id = "Antarctica/Casey", .utcOffset = 39600, .names = AWST_ZONE_NAMES, .rules = ANTARCTICA_CASEY_RULES},
-        {.id = "Antarctica/Davis", .utcOffset = 25200, .names = DAVT_ZONE_NAMES, .rules = ANTARCTICA_DAVIS_RULES},
-        {.id = "Antarctica/DumontDUrville", .utcOffset = 36000, .names = DDUT_ZONE_NAMES, .rules = NULL},
-        {.id = "Antarctica/Macquarie", .utcOffset = 36000, .names = MIST_ZONE_NAMES, .rules = ANTARCTICA_MACQUARIE_RULES},
-        {.id = "Antarctica/Mawson", .utcOffset = 18000, .names = MAWT_ZONE_NAMES, .rules = ANTARCTICA_MAWSON_RULES},
-        {.id = "Antarctica/McMurdo", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = ANTARCTICA_MCMURDO_RULES},
-        {.id = "Antarctica/Palmer", .utcOffset = -10800, .names = CLT_ZONE_NAMES, .rules = ANTARCTICA_PALMER_RULES},
-        {.id = "Antarctica/Rothera", .utcOffset = -10800, .names = ROTT_ZONE_NAMES, .rules = ANTARCTICA_ROTHERA_RULES},
-        {.id = "Antarctica/South_Pole", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = NULL},
-        {.id = "Antarctica/Syowa", .utcOffset = 10800, .names = SYOT_ZONE_NAMES, .rules = NULL},
-        {.id = "Antarctica/Troll", .utcOffset = 7200, .names = UTC_ZONE_NAMES, .rules = ANTARCTICA_TROLL_RULES},
-        {.id = "Antarctica/Vostok", .utcOffset = 21600, .names = VOST_ZONE_NAMES, .rules = NULL},
-        {.id = "Arctic/Longyearbyen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = ARCTIC_LONGYEARBYEN_RULES},
-        {.id = "Asia/Aden", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Almaty", .utcOffset = 21600, .names = ALMT_ZONE_NAMES, .rules = ASIA_ALMATY_RULES},
-        {.id = "Asia/Amman", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_AMMAN_RULES},
-        {.id = "Asia/Anadyr", .utcOffset = 43200, .names = ANAT_ZONE_NAMES, .rules = ASIA_ANADYR_RULES},
-        {.id = "Asia/Aqtau", .utcOffset = 18000, .names = AQTT_ZONE_NAMES, .rules = ASIA_AQTAU_RULES},
-        {.id = "Asia/Aqtobe", .utcOffset = 18000, .names = AQTT_ZONE_NAMES, .rules = ASIA_AQTOBE_RULES},
-        {.id = "Asia/Ashgabat", .utcOffset = 18000, .names = TMT_ZONE_NAMES, .rules = ASIA_ASHGABAT_RULES},
-        {.id = "Asia/Ashkhabad", .utcOffset = 18000, .names = TMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Atyrau", .utcOffset = 18000, .names = GMT_05_00_ZONE_NAMES, .rules = ASIA_ATYRAU_RULES},
-        {.id = "Asia/Baghdad", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_BAGHDAD_RULES},
-        {.id = "Asia/Bahrain", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_BAHRAIN_RULES},
-        {.id = "Asia/Baku", .utcOffset = 14400, .names = AZT_ZONE_NAMES, .rules = ASIA_BAKU_RULES},
-        {.id = "Asia/Bangkok", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Barnaul", .utcOffset = 25200, .names = GMT_07_00_ZONE_NAMES, .rules = ASIA_BARNAUL_RULES},
-        {.id = "Asia/Beirut", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_BEIRUT_RULES},
-        {.id = "Asia/Bishkek", .utcOffset = 21600, .names = KGT_ZONE_NAMES, .rules = ASIA_BISHKEK_RULES},
-        {.id = "Asia/Brunei", .utcOffset = 28800, .names = BNT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Calcutta", .utcOffset = 19800, .names = IST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Chita", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_CHITA_RULES},
-        {.id = "Asia/Choibalsan", .utcOffset = 28800, .names = CHOT_ZONE_NAMES, .rules = ASIA_CHOIBALSAN_RULES},
-        {.id = "Asia/Chongqing", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Chungking", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Colombo", .utcOffset = 19800, .names = IST_ZONE_NAMES, .rules = ASIA_COLOMBO_RULES},
-        {.id = "Asia/Dacca", .utcOffset = 21600, .names = BDT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Damascus", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_DAMASCUS_RULES},
-        {.id = "Asia/Dhaka", .utcOffset = 21600, .names = BDT_ZONE_NAMES, .rules = ASIA_DHAKA_RULES},
-        {.id = "Asia/Dili", .utcOffset = 32400, .names = TLT_ZONE_NAMES, .rules = ASIA_DILI_RULES},
-        {.id = "Asia/Dubai", .utcOffset = 14400, .names = GST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Dushanbe", .utcOffset = 18000, .names = TJT_ZONE_NAMES, .rules = ASIA_DUSHANBE_RULES},
-        {.id = "Asia/Famagusta", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_FAMAGUSTA_RULES},
-        {.id = "Asia/Gaza", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_GAZA_RULES},
-        {.id = "Asia/Harbin", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Hebron", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_HEBRON_RULES},
-        {.id = "Asia/Ho_Chi_Minh", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = ASIA_HO_CHI_MINH_RULES},
-        {.id = "Asia/Hong_Kong", .utcOffset = 28800, .names = HKT_ZONE_NAMES, .rules = ASIA_HONG_KONG_RULES},
-        {.id = "Asia/Hovd", .utcOffset = 25200, .names = HOVT_ZONE_NAMES, .rules = ASIA_HOVD_RULES},
-        {.id = "Asia/Irkutsk", .utcOffset = 28800, .names = IRKT_ZONE_NAMES, .rules = ASIA_IRKUTSK_RULES},
-        {.id = "Asia/Istanbul", .utcOffset = 10800, .names = TRT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Jakarta", .utcOffset = 25200, .names = WIB_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Jayapura", .utcOffset = 32400, .names = WIT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Jerusalem", .utcOffset = 10800, .names = IST_ZONE_NAMES, .rules = ASIA_JERUSALEM_RULES},
-        {.id = "Asia/Kabul", .utcOffset = 16200, .names = AFT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Kamchatka", .utcOffset = 43200, .names = PETT_ZONE_NAMES, .rules = ASIA_KAMCHATKA_RULES},
-        {.id = "Asia/Karachi", .utcOffset = 18000, .names = PKT_ZONE_NAMES, .rules = ASIA_KARACHI_RULES},
-        {.id = "Asia/Kashgar", .utcOffset = 21600, .names = XJT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Kathmandu", .utcOffset = 20700, .names = NPT_ZONE_NAMES, .rules = ASIA_KATHMANDU_RULES},
-        {.id = "Asia/Katmandu", .utcOffset = 20700, .names = NPT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Khandyga", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_KHANDYGA_RULES},
-        {.id = "Asia/Kolkata", .utcOffset = 19800, .names = IST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Krasnoyarsk", .utcOffset = 25200, .names = KRAT_ZONE_NAMES, .rules = ASIA_KRASNOYARSK_RULES},
-        {.id = "Asia/Kuala_Lumpur", .utcOffset = 28800, .names = MYT_ZONE_NAMES, .rules = ASIA_KUALA_LUMPUR_RULES},
-        {.id = "Asia/Kuching", .utcOffset = 28800, .names = MYT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Kuwait", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Macao", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Macau", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_MACAU_RULES},
-        {.id = "Asia/Magadan", .utcOffset = 39600, .names = MAGT_ZONE_NAMES, .rules = ASIA_MAGADAN_RULES},
-        {.id = "Asia/Makassar", .utcOffset = 28800, .names = WITA_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Manila", .utcOffset = 28800, .names = PST_ZONE_NAMES, .rules = ASIA_MANILA_RULES},
-        {.id = "Asia/Muscat", .utcOffset = 14400, .names = GST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Nicosia", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_NICOSIA_RULES},
-        {.id = "Asia/Novokuznetsk", .utcOffset = 25200, .names = KRAT_ZONE_NAMES, .rules = ASIA_NOVOKUZNETSK_RULES},
-        {.id = "Asia/Novosibirsk", .utcOffset = 25200, .names = NOVT_ZONE_NAMES, .rules = ASIA_NOVOSIBIRSK_RULES},
-        {.id = "Asia/Omsk", .utcOffset = 21600, .names = OMST_ZONE_NAMES, .rules = ASIA_OMSK_RULES},
-        {.id = "Asia/Oral", .utcOffset = 18000, .names = ORAT_ZONE_NAMES, .rules = ASIA_ORAL_RULES},
-        {.id = "Asia/Phnom_Penh", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Pontianak", .utcOffset = 25200, .names = WIB_ZONE_NAMES, .rules = ASIA_PONTIANAK_RULES},
-        {.id = "Asia/Pyongyang", .utcOffset = 32400, .names = KST_ZONE_NAMES, .rules = ASIA_PYONGYANG_RULES},
-        {.id = "Asia/Qatar", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_QATAR_RULES},
-        {.id = "Asia/Qostanay", .utcOffset = 21600, .names = QOST_ZONE_NAMES, .rules = ASIA_QOSTANAY_RULES},
-        {.id = "Asia/Qyzylorda", .utcOffset = 18000, .names = QYZT_ZONE_NAMES, .rules = ASIA_QYZYLORDA_RULES},
-        {.id = "Asia/Rangoon", .utcOffset = 23400, .names = MMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Riyadh", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Saigon", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Sakhalin", .utcOffset = 39600, .names = SAKT_ZONE_NAMES, .rules = ASIA_SAKHALIN_RULES},
-        {.id = "Asia/Samarkand", .utcOffset = 18000, .names = UZT_ZONE_NAMES, .rules = ASIA_SAMARKAND_RULES},
-        {.id = "Asia/Seoul", .utcOffset = 32400, .names = KST_ZONE_NAMES, .rules = ASIA_SEOUL_RULES},
-        {.id = "Asia/Shanghai", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_SHANGHAI_RULES},
-        {.id = "Asia/Singapore", .utcOffset = 28800, .names = SGT_ZONE_NAMES, .rules = ASIA_SINGAPORE_RULES},
-        {.id = "Asia/Srednekolymsk", .utcOffset = 39600, .names = SRET_ZONE_NAMES, .rules = ASIA_SREDNEKOLYMSK_RULES},
-        {.id = "Asia/Taipei", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_TAIPEI_RULES},
-        {.id = "Asia/Tashkent", .utcOffset = 18000, .names = UZT_ZONE_NAMES, .rules = ASIA_TASHKENT_RULES},
-        {.id = "Asia/Tbilisi", .utcOffset = 14400, .names = GET_ZONE_NAMES, .rules = ASIA_TBILISI_RULES},
-        {.id = "Asia/Tehran", .utcOffset = 16200, .names = IRST_ZONE_NAMES, .rules = ASIA_TEHRAN_RULES},
-        {.id = "Asia/Tel_Aviv", .utcOffset = 10800, .names = IST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Thimbu", .utcOffset = 21600, .names = BTT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Thimphu", .utcOffset = 21600, .names = BTT_ZONE_NAMES, .rules = ASIA_THIMPHU_RULES},
-        {.id = "Asia/Tokyo", .utcOffset = 32400, .names = JST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Tomsk", .utcOffset = 25200, .names = GMT_07_00_ZONE_NAMES, .rules = ASIA_TOMSK_RULES},
-        {.id = "Asia/Ujung_Pandang", .utcOffset = 28800, .names = WITA_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Ulaanbaatar", .utcOffset = 28800, .names = ULAT_ZONE_NAMES, .rules = ASIA_ULAANBAATAR_RULES},
-        {.id = "Asia/Ulan_Bator", .utcOffset = 28800, .names = ULAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Urumqi", .utcOffset = 21600, .names = XJT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Ust-Nera", .utcOffset = 36000, .names = VLAT_ZONE_NAMES, .rules = ASIA_UST_NERA_RULES},
-        {.id = "Asia/Vientiane", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Vladivostok", .utcOffset = 36000, .names = VLAT_ZONE_NAMES, .rules = ASIA_VLADIVOSTOK_RULES},
-        {.id = "Asia/Yakutsk", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_YAKUTSK_RULES},
-        {.id = "Asia/Yangon", .utcOffset = 23400, .names = MMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Yekaterinburg", .utcOffset = 18000, .names = YEKT_ZONE_NAMES, .rules = ASIA_YEKATERINBURG_RULES},
-        {.id = "Asia/Yerevan", .utcOffset = 14400, .names = AMT_ZONE_NAMES, .rules = ASIA_YEREVAN_RULES},
-        {.id = "Atlantic/Azores", .utcOffset = 0, .names = AZOT_ZONE_NAMES, .rules = ATLANTIC_AZORES_RULES},
-        {.id = "Atlantic/Bermuda", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = ATLANTIC_BERMUDA_RULES},
-        {.id = "Atlantic/Canary", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_CANARY_RULES},
-        {.id = "Atlantic/Cape_Verde", .utcOffset = -3600, .names = CVT_ZONE_NAMES, .rules = ATLANTIC_CAPE_VERDE_RULES},
-        {.id = "Atlantic/Faeroe", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = NULL},
-        {.id = "Atlantic/Faroe", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_FAROE_RULES},
-        {.id = "Atlantic/Jan_Mayen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = NULL},
-        {.id = "Atlantic/Madeira", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_MADEIRA_RULES},
-        {.id = "Atlantic/Reykjavik", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Atlantic/South_Georgia", .utcOffset = -7200, .names = GST_ZONE_NAMES, .rules = NULL},
-        {.id = "Atlantic/St_Helena", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Atlantic/Stanley", .utcOffset = -10800, .names = FKT_ZONE_NAMES, .rules = ATLANTIC_STANLEY_RULES},
-        {.id = "Australia/ACT", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Adelaide", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = AUSTRALIA_ADELAIDE_RULES},
-        {.id = "Australia/Brisbane", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_BRISBANE_RULES},
-        {.id = "Australia/Broken_Hill", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = AUSTRALIA_BROKEN_HILL_RULES},
-        {.id = "Australia/Canberra", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Currie", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Darwin", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Eucla", .utcOffset = 31500, .names = ACWST_ZONE_NAMES, .rules = AUSTRALIA_EUCLA_RULES},
-        {.id = "Australia/Hobart", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_HOBART_RULES},
-        {.id = "Australia/LHI", .utcOffset = 37800, .names = LHST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Lindeman", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_LINDEMAN_RULES},
-        {.id = "Australia/Lord_Howe", .utcOffset = 37800, .names = LHST_ZONE_NAMES, .rules = AUSTRALIA_LORD_HOWE_RULES},
-        {.id = "Australia/Melbourne", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_MELBOURNE_RULES},
-        {.id = "Australia/NSW", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/North", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Perth", .utcOffset = 28800, .names = AWST_ZONE_NAMES, .rules = AUSTRALIA_PERTH_RULES},
-        {.id = "Australia/Queensland", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/South", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Sydney", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_SYDNEY_RULES},
-        {.id = "Australia/Tasmania", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Victoria", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/West", .utcOffset = 28800, .names = AWST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Yancowinna", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = NULL},
-        {.id = "Brazil/Acre", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = NULL},
-        {.id = "Brazil/DeNoronha", .utcOffset = -7200, .names = FNT_ZONE_NAMES, .rules = NULL},
-        {.id = "Brazil/East", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = NULL},
-        {.id = "Brazil/West", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = NULL},
-        {.id = "CET", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = NULL},
-        {.id = "CST6CDT", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Canada/Atlantic", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "Canada/Central", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Canada/Eastern", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "Canada/Mountain", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "Canada/Newfoundland", .utcOffset = -9000, .names = NST_ZONE_NAMES, .rules = NULL},
-        {.id = "Canada/Pacific", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "Canada/Saskatchewan", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Canada/Yukon", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "Chile/Continental", .utcOffset = -14400, .names = CLT_ZONE_NAMES, .rules = NULL},
-        {.id = "Chile/EasterIsland", .utcOffset = -21600, .names = EAST_ZONE_NAMES, .rules = NULL},
-        {.id = "Cuba", .utcOffset = -14400, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "EET", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = NULL},
-        {.id = "EST5EDT", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "Egypt", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = NULL},
-        {.id = "Eire", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Europe/Amsterdam", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_AMSTERDAM_RULES},
-        {.id = "Europe/Andorra", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ANDORRA_RULES},
-        {.id = "Europe/Astrakhan", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_ASTRAKHAN_RULES},
-        {.id = "Europe/Athens", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_ATHENS_RULES},
-        {.id = "Europe/Belfast", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Europe/Belgrade", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BELGRADE_RULES},
-        {.id = "Europe/Berlin", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BERLIN_RULES},
-        {.id = "Europe/Bratislava", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BRATISLAVA_RULES},
-        {.id = "Europe/Brussels", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BRUSSELS_RULES},
-        {.id = "Europe/Bucharest", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_BUCHAREST_RULES},
-        {.id = "Europe/Budapest", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BUDAPEST_RULES},
-        {.id = "Europe/Busingen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BUSINGEN_RULES},
-        {.id = "Europe/Chisinau", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_CHISINAU_RULES},
-        {.id = "Europe/Copenhagen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_COPENHAGEN_RULES},
-        {.id = "Europe/Dublin", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_DUBLIN_RULES},
-        {.id = "Europe/Gibraltar", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_GIBRALTAR_RULES},
-        {.id = "Europe/Guernsey", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_GUERNSEY_RULES},
-        {.id = "Europe/Helsinki", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_HELSINKI_RULES},
-        {.id = "Europe/Isle_of_Man", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_ISLE_OF_MAN_RULES},
-        {.id = "Europe/Istanbul", .utcOffset = 10800, .names = TRT_ZONE_NAMES, .rules = EUROPE_ISTANBUL_RULES},
-        {.id = "Europe/Jersey", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_JERSEY_RULES},
-        {.id = "Europe/Kaliningrad", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = EUROPE_KALININGRAD_RULES},
-        {.id = "Europe/Kiev", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_KIEV_RULES},
-        {.id = "Europe/Kirov", .utcOffset = 10800, .names = GMT_03_00_ZONE_NAMES, .rules = EUROPE_KIROV_RULES},
-        {.id = "Europe/Lisbon", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = EUROPE_LISBON_RULES},
-        {.id = "Europe/Ljubljana", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_LJUBLJANA_RULES},
-        {.id = "Europe/London", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_LONDON_RULES},
-        {.id = "Europe/Luxembourg", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_LUXEMBOURG_RULES},
-        {.id = "Europe/Madrid", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MADRID_RULES},
-        {.id = "Europe/Malta", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MALTA_RULES},
-        {.id = "Europe/Mariehamn", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_MARIEHAMN_RULES},
-        {.id = "Europe/Minsk", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_MINSK_RULES},
-        {.id = "Europe/Monaco", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MONACO_RULES},
-        {.id = "Europe/Moscow", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_MOSCOW_RULES},
-        {.id = "Europe/Nicosia", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = NULL},
-        {.id = "Europe/Oslo", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_OSLO_RULES},
-        {.id = "Europe/Paris", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PARIS_RULES},
-        {.id = "Europe/Podgorica", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PODGORICA_RULES},
-        {.id = "Europe/Prague", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PRAGUE_RULES},
-        {.id = "Europe/Riga", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_RIGA_RULES},
-        {.id = "Europe/Rome", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ROME_RULES},
-        {.id = "Europe/Samara", .utcOffset = 14400, .names = SAMT_ZONE_NAMES, .rules = EUROPE_SAMARA_RULES},
-        {.id = "Europe/San_Marino", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SAN_MARINO_RULES},
-        {.id = "Europe/Sarajevo", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SARAJEVO_RULES},
-        {.id = "Europe/Saratov", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_SARATOV_RULES},
-        {.id = "Europe/Simferopol", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_SIMFEROPOL_RULES},
-        {.id = "Europe/Skopje", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SKOPJE_RULES},
-        {.id = "Europe/Sofia", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_SOFIA_RULES},
-        {.id = "Europe/Stockholm", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_STOCKHOLM_RULES},
-        {.id = "Europe/Tallinn", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_TALLINN_RULES},
-        {.id = "Europe/Tirane", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_TIRANE_RULES},
-        {.id = "Europe/Tiraspol", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = NULL},
-        {.id = "Europe/Ulyanovsk", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_ULYANOVSK_RULES},
-        {.id = "Europe/Uzhgorod", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_UZHGOROD_RULES},
-        {.id = "Europe/Vaduz", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VADUZ_RULES},
-        {.id = "Europe/Vatican", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VATICAN_RULES},
-        {.id = "Europe/Vienna", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VIENNA_RULES},
-        {.id = "Europe/Vilnius", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_VILNIUS_RULES},
-        {.id = "Europe/Volgograd", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_VOLGOGRAD_RULES},
-        {.id = "Europe/Warsaw", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_WARSAW_RULES},
-        {.id = "Europe/Zagreb", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ZAGREB_RULES},
-        {.id = "Europe/Zaporozhye", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_ZAPOROZHYE_RULES},
-        {.id = "Europe/Zurich", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ZURICH_RULES},
-        {.id = "GB", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "GB-Eire", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Greenwich", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Hongkong", .utcOffset = 28800, .names = HKT_ZONE_NAMES, .rules = NULL},
-        {.id = "Iceland", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Antananarivo", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Chagos", .utcOffset = 21600, .names = IOT_ZONE_NAMES, .rules = INDIAN_CHAGOS_RULES},
-        {.id = "Indian/Christmas", .utcOffset = 25200, .names = CXT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Cocos", .utcOffset = 23400, .names = CCT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Comoro", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Kerguelen", .utcOffset = 18000, .names = TFT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Mahe", .utcOffset = 14400, .names = SCT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Maldives", .utcOffset = 18000, .names = MVT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Mauritius", .utcOffset = 14400, .names = MUT_ZONE_NAMES, .rules = INDIAN_MAURITIUS_RULES},
-        {.id = "Indian/Mayotte", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Reunion", .utcOffset = 14400, .names = RET_ZONE_NAMES, .rules = NULL},
-        {.id = "Iran", .utcOffset = 16200, .names = IRST_ZONE_NAMES, .rules = NULL},
-        {.id = "Israel", .utcOffset = 10800, .names = IST_ZONE_NAMES, .rules = NULL},
-        {.id = "Jamaica", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "Japan", .utcOffset = 32400, .names = JST_ZONE_NAMES, .rules = NULL},
-        {.id = "Kwajalein", .utcOffset = 43200, .names = MHT_ZONE_NAMES, .rules = NULL},
-        {.id = "Libya", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = NULL},
-        {.id = "MET", .utcOffset = 7200, .names = MET_ZONE_NAMES, .rules = NULL},
-        {.id = "MST7MDT", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "Mexico/BajaNorte", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "Mexico/BajaSur", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "Mexico/General", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "NZ", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = NULL},
-        {.id = "NZ-CHAT", .utcOffset = 45900, .names = CHAST_ZONE_NAMES, .rules = NULL},
-        {.id = "Navajo", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "PRC", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "PST8PDT", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Apia", .utcOffset = 46800, .names = WSST_ZONE_NAMES, .rules = PACIFIC_APIA_RULES},
-        {.id = "Pacific/Auckland", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = PACIFIC_AUCKLAND_RULES},
-        {.id = "Pacific/Bougainville", .utcOffset = 39600, .names = BST_ZONE_NAMES, .rules = PACIFIC_BOUGAINVILLE_RULES},
-        {.id = "Pacific/Chatham", .utcOffset = 45900, .names = CHAST_ZONE_NAMES, .rules = PACIFIC_CHATHAM_RULES},
-        {.id = "Pacific/Chuuk", .utcOffset = 36000, .names = CHUT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Easter", .utcOffset = -21600, .names = EAST_ZONE_NAMES, .rules = PACIFIC_EASTER_RULES},
-        {.id = "Pacific/Efate", .utcOffset = 39600, .names = VUT_ZONE_NAMES, .rules = PACIFIC_EFATE_RULES},
-        {.id = "Pacific/Enderbury", .utcOffset = 46800, .names = PHOT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Fakaofo", .utcOffset = 46800, .names = TKT_ZONE_NAMES, .rules = PACIFIC_FAKAOFO_RULES},
-        {.id = "Pacific/Fiji", .utcOffset = 43200, .names = FJT_ZONE_NAMES, .rules = PACIFIC_FIJI_RULES},
-        {.id = "Pacific/Funafuti", .utcOffset = 43200, .names = TVT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Galapagos", .utcOffset = -21600, .names = GALT_ZONE_NAMES, .rules = PACIFIC_GALAPAGOS_RULES},
-        {.id = "Pacific/Gambier", .utcOffset = -32400, .names = GAMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Guadalcanal", .utcOffset = 39600, .names = SBT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Guam", .utcOffset = 36000, .names = ChST_ZONE_NAMES, .rules = PACIFIC_GUAM_RULES},
-        {.id = "Pacific/Honolulu", .utcOffset = -36000, .names = HST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Johnston", .utcOffset = -36000, .names = HST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Kiritimati", .utcOffset = 50400, .names = LINT_ZONE_NAMES, .rules = PACIFIC_KIRITIMATI_RULES},
-        {.id = "Pacific/Kosrae", .utcOffset = 39600, .names = KOST_ZONE_NAMES, .rules = PACIFIC_KOSRAE_RULES},
-        {.id = "Pacific/Kwajalein", .utcOffset = 43200, .names = MHT_ZONE_NAMES, .rules = PACIFIC_KWAJALEIN_RULES},
-        {.id = "Pacific/Majuro", .utcOffset = 43200, .names = MHT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Marquesas", .utcOffset = -34200, .names = MART_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Midway", .utcOffset = -39600, .names = SST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Nauru", .utcOffset = 43200, .names = NRT_ZONE_NAMES, .rules = PACIFIC_NAURU_RULES},
-        {.id = "Pacific/Niue", .utcOffset = -39600, .names = NUT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Norfolk", .utcOffset = 39600, .names = NFT_ZONE_NAMES, .rules = PACIFIC_NORFOLK_RULES},
-        {.id = "Pacific/Noumea", .utcOffset = 39600, .names = NCT_ZONE_NAMES, .rules = PACIFIC_NOUMEA_RULES},
-        {.id = "Pacific/Pago_Pago", .utcOffset = -39600, .names = SST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Palau", .utcOffset = 32400, .names = PWT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Pitcairn", .utcOffset = -28800, .names = PST_ZONE_NAMES, .rules = PACIFIC_PITCAIRN_RULES},
-        {.id = "Pacific/Pohnpei", .utcOffset = 39600, .names = PONT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Ponape", .utcOffset = 39600, .names = PONT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Port_Moresby", .utcOffset = 36000, .names = PGT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Rarotonga", .utcOffset = -36000, .names = CKT_ZONE_NAMES, .rules = PACIFIC_RAROTONGA_RULES},
-        {.id = "Pacific/Saipan", .utcOffset = 36000, .names = ChST_ZONE_NAMES, .rules = PACIFIC_SAIPAN_RULES},
-        {.id = "Pacific/Samoa", .utcOffset = -39600, .names = SST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Tahiti", .utcOffset = -36000, .names = TAHT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Tarawa", .utcOffset = 43200, .names = GILT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Tongatapu", .utcOffset = 46800, .names = TOT_ZONE_NAMES, .rules = PACIFIC_TONGATAPU_RULES},
-        {.id = "Pacific/Truk", .utcOffset = 36000, .names = CHUT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Wake", .utcOffset = 43200, .names = WAKT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Wallis", .utcOffset = 43200, .names = WFT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Yap", .utcOffset = 36000, .names = CHUT_ZONE_NAMES, .rules = NULL},
-        {.id = "Poland", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = NULL},
-        {.id = "Portugal", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = NULL},
-        {.id = "ROK", .utcOffset = 32400, .names = KST_ZONE_NAMES, .rules = NULL},
-        {.id = "Singapore", .utcOffset = 28800, .names = SGT_ZONE_NAMES, .rules = NULL},
-        {.id = "Turkey", .utcOffset = 10800, .names = TRT_ZONE_NAMES, .rules = NULL},
-        {.id = "UCT", .utcOffset = 0, .names = UTC_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Alaska", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Aleutian", .utcOffset = -32400, .names = HST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Arizona", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Central", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/East-Indiana", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Eastern", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Hawaii", .utcOffset = -36000, .names = HST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Indiana-Starke", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Michigan", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Mountain", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Pacific", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "US/Samoa", .utcOffset = -39600, .names = SST_ZONE_NAMES, .rules = NULL},
-        {.id = "Universal", .utcOffset = 0, .names = UTC_ZONE_NAMES, .rules = NULL},
-        {.id = "W-SU", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = NULL},
-        {.id = "WET", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = NULL},
-        {.id = "Zulu", .utcOffset = 0, .names = UTC_ZONE_NAMES, .rules = NULL},
-        #endif
-};
+/* Zone and offset of zone name or abbreviation, same name can be used by zones with different offsets, such as "IST"*/
+typedef struct ZoneNameCandidate {
+    const char *name;           // short or long name, such as "PST" or "Pacific Standard Time"
+    const char *zoneId;         // zone with most aliases among zones with this name and offset, such as "America/Los_Angeles"
+    int32_t offset;             // in seconds
+    bool isDaylightTime;
+    uint8_t candidateCount;     // count of candidates with the same name, starting from this one
+} ZoneNameCandidate;
+
+extern const TimeZone UTC;
+extern const TimeZone GMT;
+
+/* All supported zones sorted by id, empty when ENABLE_TIME_ZONE_SUPPORT is not defined*/
+extern const TimeZone ZONE_LIST[];
+extern const uint16_t ZONE_LIST_LENGTH;
 
+/* IANA tzdata version of generated zone data, such as "2025b"*/
+extern const char *const TIME_ZONE_DATA_VERSION;
 
+/* Link table with canonical zone index for each ZONE_LIST entry, such as "Africa/Nairobi" for "Africa/Asmera".
+ * Alias entries share names and rules of the canonical zone*/
+extern const uint16_t ZONE_LINK_INDEXES[];
+
+
+/* Finds zone by id with single perfect hash probe, NULL if zone not found*/
 const TimeZone *findTimeZone(const char *zoneId);
 
+/* Same as findTimeZone(), but id is not required to be null terminated, such as slice of the parsed text.
+ * Params:
+ *  zoneId – the zone id characters
+ *  length – the count of id characters
+ * Returns: found zone or NULL*/
+const TimeZone *findTimeZoneWithLength(const char *zoneId, uint32_t length);
+
+/* Finds zones and offsets by standard or daylight zone name, such as "PST", "CEST" or "Pacific Daylight Time".
+ * Candidates of the same name are ordered by count of zones using them, so the first one is the most common meaning.
+ * Params:
+ *  name – the name characters, not required to be null terminated
+ *  length – the count of name characters
+ *  candidates – set to the first candidate of the name
+ * Returns: count of candidates, 0 if name is unknown or ENABLE_TIME_ZONE_SUPPORT is not defined*/
+uint8_t findZoneNameCandidates(const char *name, uint32_t length, const ZoneNameCandidate **candidates);
+
+/* Returns count of the supported zones in ZONE_LIST*/
+uint16_t getTimeZoneCount();
+
+/* Returns zone by index in ZONE_LIST sorted by id, NULL if index is out of range*/
+const TimeZone *getTimeZoneByIndex(uint16_t zoneIndex);
+
 int32_t resolveTimeZoneOffset(int64_t epochSeconds, const TimeZone *zone);
+
+/* Same as resolveTimeZoneOffset(), but first checks the last transition window stored in cache.
+ * When epoch seconds falls inside that window, no rule search is done. Cache keeps hit and miss counters.
+ * Params:
+ *  cache – the zero initialized lookup cache, NULL disables caching
+ * Returns: zone offset in seconds*/
+int32_t resolveTimeZoneOffsetCached(ZoneTransitionCache *cache, int64_t epochSeconds, const TimeZone *zone);
+
+/* Same as resolveTimeZoneOffset(), but zone rules are taken from the cached year of epoch seconds.
+ * Cached year lookup is a range check, then at most two compares select the rules pair of the year.
+ * Cache is reset when used with other zone.
+ * Params:
+ *  cache – the zero initialized year cache, NULL disables caching
+ * Returns: zone offset in seconds*/
+int32_t resolveTimeZoneOffsetYearCached(ZoneYearCache *cache, int64_t epochSeconds, const TimeZone *zone);
+
+/* Resolves zone offsets for array of epoch seconds.
+ * Sorted input is merge walked against zone rules, so total cost is O(n + t) instead of n binary searches.
+ * Each element that is smaller than the previous one falls back to binary search.
+ * After the last zone rule, recurring rule pair is calculated again only when epoch seconds leave its window.
+ * Params:
+ *  epochSeconds – the epoch seconds, preferably sorted ascending
+ *  count – the count of epoch seconds
+ *  zone – the time-zone
+ *  offsets – the result offsets in seconds, same length as epoch seconds*/
+void resolveTimeZoneOffsetBatch(const int64_t *epochSeconds, size_t count, const TimeZone *zone, int32_t *offsets);
 const char *resolveTimeZoneName(int64_t epochSeconds, const TimeZone *zone, ZoneTextStyle textStyle);
+
+/* Returns true if zone rule in effect at epoch seconds is daylight saving time, false for standard time or zone without rules*/
+bool isTimeZoneDaylightTime(int64_t epochSeconds, const TimeZone *zone);
+
+/* Finds the pair of zone rules surrounding provided epoch seconds.
+ * Rules are searched with binary search, so lookup cost is O(log n) for any rule history depth.
+ * When zone 'ruleCount' is not set, length of the rules is resolved by counting until terminating entry.
+ * Returns:
+ * transition with 'before' and 'after' rules, or both NULL when zone has no rules for provided epoch seconds*/
 ZoneTransition findZoneRuleTransition(int64_t epochSeconds, const TimeZone *zone);
 
+/* Same as findZoneRuleTransition(), but reuses the last transition window stored in cache when epoch seconds falls inside it.
+ * Reused window rules point to the cache, so they are valid until the next lookup with the same cache*/
+ZoneTransition findZoneRuleTransitionCached(ZoneTransitionCache *cache, int64_t epochSeconds, const TimeZone *zone);
+
+/* Finds the pair of transitions surrounding provided epoch seconds from zone recurring rule.
+ * Applies only to zones with daylight saving time and only after the last transition of zone rules.
+ * Transitions are calculated arithmetically for the epoch year, adjacent year only when epoch is outside of its transitions.
+ * Returned pair applies to all epoch seconds after 'before' and up to 'after' transition, so decoded rules can be reused.
+ * Params:
+ *  decodedRules – the storage for the two calculated rules, returned transition points to it
+ * Returns:
+ * transition with 'before' and 'after' rules, or both NULL when recurring rule is not applicable*/
+ZoneTransition findRecurringRuleTransition(int64_t epochSeconds, const TimeZone *zone, TimeZoneRule decodedRules[2]);
+
+/* Parses POSIX TZ string, such as TZif file footer "CET-1CEST,M3.5.0,M10.5.0/3" or "EST5EDT" with default US dates.
+ * Params:
+ *  posixRule – the TZ string without leading ':' and surrounding new lines
+ *  recurringRule – the parsed result, not modified on error
+ * Returns: true if TZ string is valid*/
+bool parseZoneRecurringRule(const char *posixRule, ZoneRecurringRule *recurringRule);
+
+/* Packs zone rules to the compact table representation.
+ * Storage for transitions and palette indexes should have 'ruleCount' length.
+ * Params:
+ *  rules – the sorted zone rules, without terminating entry
+ *  ruleCount – the count of the rules
+ *  compactRules – the packed rules result, points to provided storage
+ *  offsetTypesCapacity – the max count of distinct offsets in palette storage
+ * Returns: true if rules has been packed, false when palette is too small or rules span more than 136 years*/
+bool packTimeZoneRules(const TimeZoneRule *rules, uint16_t ruleCount, CompactTimeZoneRules *compactRules,
+                       uint32_t *transitionDeltas, uint8_t *offsetTypeIndexes, ZoneOffsetType *offsetTypes, uint8_t offsetTypesCapacity);
+
+/* Same as findZoneRuleTransition(), but searches compact rules in place.
+ * Only the two found rules are decoded to provided storage, returned transition points to it*/
+ZoneTransition findCompactZoneRuleTransition(int64_t epochSeconds, const CompactTimeZoneRules *compactRules, TimeZoneRule decodedRules[2]);
+
+/* Same as resolveTimeZoneOffset(), but with zone rules taken from compact table*/
+int32_t resolveCompactTimeZoneOffset(int64_t epochSeconds, const CompactTimeZoneRules *compactRules, const TimeZone *zone);
+
+/* Decodes compact rules to the rule table, storage should have at least 'ruleCount' length.
+ * Terminating entry is not written, it should be added when table is used as zone rules.
+ * Returns: true if all rules has been decoded, false on invalid palette index or too small storage*/
+bool unpackTimeZoneRules(const CompactTimeZoneRules *compactRules, TimeZoneRule *rules, uint16_t rulesCapacity);
+
+/* Compresses zone rules to varint stream, data storage of 'ruleCount * VARINT_RULE_MAX_LENGTH' bytes is always enough.
+ * Params:
+ *  rules – the sorted zone rules, without terminating entry
+ *  ruleCount – the count of the rules
+ *  varintRules – the compressed rules result, points to provided storage
+ *  data – the storage for encoded rules
+ *  dataCapacity – the size of data storage in bytes
+ *  offsetTypes – the storage for offset palette
+ *  offsetTypesCapacity – the max count of distinct offsets in palette storage
+ * Returns: true if rules has been compressed, false when storage is too small*/
+bool packVarintTimeZoneRules(const TimeZoneRule *rules, uint16_t ruleCount, VarintTimeZoneRules *varintRules,
+                             uint8_t *data, uint32_t dataCapacity, ZoneOffsetType *offsetTypes, uint8_t offsetTypesCapacity);
+
+/* Decodes compressed rules to the rule table, storage should have at least 'ruleCount' length.
+ * Terminating entry is not written, it should be added when table is used as zone rules.
+ * Returns: true if all rules has been decoded, false on corrupted data or too small storage*/
+bool unpackVarintTimeZoneRules(const VarintTimeZoneRules *varintRules, TimeZoneRule *rules, uint16_t rulesCapacity);
+
+/* Builds search tree copy of zone rule transitions for findIndexedZoneRuleTransition().
+ * Storage should have at least 'ZONE_TRANSITION_BLOCK_COUNT(ruleCount)' length, index kernel is set with detectZoneSearchKernel().
+ * Params:
+ *  zone – the zone with rules
+ *  blocks – the storage for tree nodes
+ *  capacity – the length of blocks storage
+ *  index – the result, points to provided storage and zone rules
+ * Returns: true if index has been built, false when storage is too small*/
+bool buildZoneTransitionIndex(const TimeZone *zone, ZoneTransitionBlock *blocks, uint16_t capacity, ZoneTransitionIndex *index);
+
+/* Returns the fastest block compare kernel supported by running CPU, scalar when SIMD kernels are not compiled*/
+ZoneSearchKernel detectZoneSearchKernel();
+
+/* Same as findZoneRuleTransition(), but searches transition index with its block compare kernel.
+ * Kernels not supported by the build fall back to scalar compare*/
+ZoneTransition findIndexedZoneRuleTransition(int64_t epochSeconds, const ZoneTransitionIndex *index);
+
+/* Same as resolveTimeZoneOffset(), but with zone rules searched in transition index*/
+int32_t resolveIndexedTimeZoneOffset(int64_t epochSeconds, const ZoneTransitionIndex *index, const TimeZone *zone);
+
+/* Precomputes local time-line boundaries of zone rules, one for each transition between two rules.
+ * Storage should have at least 'ruleCount - 1' length, built rules are valid while zone rules are not changed.
+ * Params:
+ *  zone – the zone with rules
+ *  transitions – the storage for local transitions
+ *  capacity – the length of transitions storage
+ *  localRules – the result, points to provided storage
+ * Returns: true if local rules has been built, false when storage is too small*/
+bool buildLocalZoneRules(const TimeZone *zone, LocalZoneTransition *transitions, uint16_t capacity, LocalZoneRules *localRules);
+
+/* Resolves valid offsets for local date-time in one binary search over the local time-line boundaries.
+ * After the last zone rule transition boundaries are calculated from zone recurring rule.
+ * Params:
+ *  localEpochSeconds – the local date-time as epoch seconds without offset
+ *  localRules – the precomputed local rules of the zone, NULL to compute boundaries from zone rules during search
+ *  zone – the zone
+ * Returns: single offset, both offsets in overlap, or offsets before and after the gap*/
+LocalZoneOffsets resolveLocalZoneOffsets(int64_t localEpochSeconds, const LocalZoneRules *localRules, const TimeZone *zone);
+
+/* Initializes zone offset index, snapshot is built on the first query.
+ * Params:
+ *  index – the index to init
+ *  entries – the storage for zone entries
+ *  capacity – the length of entries storage, at least getTimeZoneCount()
+ * Returns: true if index has been initialized, false when storage is too small*/
+bool initZoneOffsetIndex(ZoneOffsetIndex *index, ZoneOffsetEntry *entries, uint16_t capacity);
+
+/* Finds zones with provided offset at epoch seconds with binary search over the offset snapshot.
+ * Params:
+ *  index – the initialized index, rebuilt when epoch seconds is outside of snapshot
+ *  epochSeconds – the instant
+ *  offset – the offset in seconds
+ *  zoneEntries – the result, points to sorted index entries with provided offset
+ * Returns: count of found zones*/
+uint16_t findZonesWithOffset(ZoneOffsetIndex *index, int64_t epochSeconds, int32_t offset, const ZoneOffsetEntry **zoneEntries);
+
+/* Finds zones whose local time passes provided second of day during epoch seconds from 'fromEpochSeconds' inclusive
+ * to 'toEpochSeconds' exclusive. Local time skipped by a gap is not passed. Each zone is returned once.
+ * Params:
+ *  index – the initialized index, rebuilt for each snapshot within the range
+ *  secondOfDay – the local time, such as 32400 for 09:00
+ *  zoneIndexes – the storage for found ZONE_LIST indexes
+ *  capacity – the length of result storage
+ * Returns: count of found zones, at most capacity*/
+uint16_t findZonesCrossingLocalTime(ZoneOffsetIndex *index, int64_t fromEpochSeconds, int64_t toEpochSeconds, int32_t secondOfDay,
+                                    uint16_t *zoneIndexes, uint16_t capacity);
+
 /* Does this transition represent a gap in the local time-line.
  * Gaps occur where there are local date-times that simply do not exist.
  * An example would be when the offset changes from +01:00 to +02:00. This might be described as 'the clocks will move forward one hour tonight at 1am'.
@@ -595,4 +328,30 @@ ZoneTransition findZoneRuleTransition(int64_t epochSeconds, const TimeZone *zone
  * true if transition is a gap for provided epoch seconds, false if it is an overlap*/
 bool isTransitionGap(ZoneTransition *transition, int64_t epochSeconds);
 
+/* Returns canonical zone of ZONE_LIST entry with the same id, for example "America/Adak" for "America/Atka".
+ * Returns: canonical zone, or provided zone when it has no entry in ZONE_LIST*/
+const TimeZone *getCanonicalTimeZone(const TimeZone *zone);
+
+/* Returns handle of provided zone. Zones and copies of zones from ZONE_LIST are resolved to their index,
+ * zones without rules named "UTC" or "GMT" to fixed offset handle. Other zones resolve to ZONE_HANDLE_EXTERNAL,
+ * their pointer should be kept along with handle and stay valid while handle is used. Has no side effects.
+ * Returns: zone handle, ZONE_HANDLE_NONE when zone is NULL*/
+ZoneHandle zoneHandleOf(const TimeZone *zone);
+
+/* Returns zone of handle.
+ * Params:
+ *  handle – the zone handle
+ *  externalZone – the zone of ZONE_HANDLE_EXTERNAL handle, ignored for other handles
+ *  fixedOffset – the offset in seconds of fixed offset zone, such as ZonedDateTime offset
+ *  fixedZone – the storage for fixed offset zone, returned zone points to it for fixed offset handles
+ * Returns: zone or NULL for ZONE_HANDLE_NONE and unknown handles*/
+const TimeZone *resolveZoneHandle(ZoneHandle handle, const TimeZone *externalZone, int32_t fixedOffset, TimeZone *fixedZone);
+
+/* Same as isTimeZoneEquals() for zones of handles, but resolved by integer compare for zones of ZONE_LIST.
+ * Fixed offset handles are equal when they have the same base zone, offsets should be compared separately.
+ * External zones are the zones of ZONE_HANDLE_EXTERNAL handles, ignored for other handles*/
+bool isZoneHandleEquals(ZoneHandle handle, const TimeZone *externalZone, ZoneHandle other, const TimeZone *otherExternalZone);
+
+/* Zones are equal when they have the same offset and resolve to the same canonical zone, so alias equals its link target.
+ * Zones without entry in ZONE_LIST are compared by id*/
 bool isTimeZoneEquals(const TimeZone *timeZone, const TimeZone *other);
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Minimal perfect hash over ZONE_LIST ids, generated by tools/TimeZoneDataGenerator.c.
+ * Id hash selects a bucket, bucket seed displaces the hash to the slot, slot holds the zone index.
+ * So lookup is one hash, one probe and one final compare*/
+#define ZONE_ID_HASH_BUCKET_COUNT 183
+#define ZONE_ID_HASH_SLOT_COUNT   549
+
+#define ZONE_ID_HASH_FNV_OFFSET   2166136261U
+#define ZONE_ID_HASH_FNV_PRIME    16777619U
+
+extern const uint16_t ZONE_ID_HASH_SEEDS[];    // seed for each bucket
+extern const uint16_t ZONE_ID_HASH_SLOTS[];    // zone index in ZONE_LIST for each slot
+
+static inline uint32_t hashZoneId(const char *zoneId, uint32_t length) {     // FNV-1a
+    uint32_t hash = ZONE_ID_HASH_FNV_OFFSET;
+    for (uint32_t i = 0; i < length; i++) {
+        hash ^= (uint8_t) zoneId[i];
+        hash *= ZONE_ID_HASH_FNV_PRIME;
+    }
+    return hash;
+}
+
+static inline uint32_t displaceZoneIdHash(uint32_t hash, uint16_t seed) {     // murmur3 finalizer
+    hash ^= seed;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static inline uint32_t zoneIdHashBucket(uint32_t hash) {
+    return hash % ZONE_ID_HASH_BUCKET_COUNT;
+}
+
+static inline uint32_t zoneIdHashSlot(uint32_t hash, uint16_t seed) {
+    return displaceZoneIdHash(hash, seed) % ZONE_ID_HASH_SLOT_COUNT;
+}
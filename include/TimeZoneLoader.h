@@ -0,0 +1,41 @@
+#pragma once
+
+#include "TimeZone.h"
+
+#ifdef ENABLE_TIME_ZONE_TZIF_LOADER
+
+#define ZONE_INFO_DEFAULT_DIRECTORY "/usr/share/zoneinfo"
+#define ZONE_INFO_PATH_MAX_LENGTH 256
+
+/* Sets directory with compiled TZif zone files, such as "/usr/share/zoneinfo".
+ * Already loaded zones are not affected, call freeLoadedTimeZones() to reload them from the new directory.
+ * Params:
+ *  directory – the zone info directory path, NULL resets to default
+ * Returns: true if directory has been set, false if path is too long*/
+bool setZoneInfoDirectory(const char *directory);
+
+/* Loads time zone from TZif (version 2 or later) file at zone info directory, such as "<directory>/Europe/Paris".
+ * File is memory mapped and parsed in place only on first request, then zone is cached and mapping released.
+ * Returned zone can be used with all TimeZone functions, names are taken from compiled zone with the same id if exists,
+ * otherwise zone abbreviations from the file are used. TZ string from the file footer is used after the last transition.
+ * Not thread safe, zones should be loaded before sharing between threads.
+ * Params:
+ *  zoneId – the zone id, such as "Europe/Paris"
+ * Returns: loaded zone or NULL when zone file not found, it is not a valid TZif file or it has leap second records,
+ * such as "right/Europe/Paris"*/
+const TimeZone *loadTimeZone(const char *zoneId);
+
+/* Releases all cached loaded zones. Previously returned zone pointers become invalid*/
+void freeLoadedTimeZones();
+
+/* Same as loadTimeZone(), but zone is read from provided directory and not cached, so each call returns a new zone.
+ * Params:
+ *  directory – the zone info directory path, NULL for directory set with setZoneInfoDirectory()
+ *  zoneId – the zone id, such as "Europe/Paris"
+ * Returns: zone that should be released with freeTimeZone(), or NULL when zone file not found or not valid*/
+const TimeZone *readTimeZone(const char *directory, const char *zoneId);
+
+/* Releases zone returned by readTimeZone()*/
+void freeTimeZone(const TimeZone *zone);
+
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "TimeZone.h"
+#include "TimeZoneIdHash.h"
+
+/* Open addressing hash over zone names and abbreviations, generated by tools/TimeZoneDataGenerator.c.
+ * Name hash selects a slot, slot holds the first candidate of the name, collisions are resolved with linear probing.
+ * Table is at most half full, so lookup is one hash and one or two probes*/
+#define ZONE_NAME_HASH_SLOT_COUNT 2048    // power of two
+#define ZONE_NAME_HASH_EMPTY_SLOT UINT16_MAX
+
+extern const ZoneNameCandidate ZONE_NAME_CANDIDATES[];     // grouped by name, most used first
+extern const uint16_t ZONE_NAME_HASH_SLOTS[];              // index of the first candidate for each slot
+
+static inline uint32_t zoneNameHashSlot(uint32_t hash) {
+    return hash & (ZONE_NAME_HASH_SLOT_COUNT - 1);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "TimeZone.h"
+
+#define ZONE_OFFSET_TABLE_BUCKET_SHIFT 10           // 1024 seconds per bucket, so bucket index is a shift
+#define ZONE_OFFSET_TABLE_MAX_OFFSETS 127
+#define ZONE_OFFSET_TABLE_CHANGE_FLAG 0x80          // bucket contains offset change, resolved with regular lookup
+
+/* Precomputed zone offsets for every bucket of the year window, trades memory (one byte per bucket,
+ * about 30 KB per year) for lookup without rules search. Each bucket holds the index in offset palette*/
+typedef struct ZoneOffsetTable {
+    const TimeZone *zone;
+    int64_t firstEpochSecond;       // start of the first bucket, January 1 of the first year at UTC
+    uint32_t bucketCount;
+    uint8_t *buckets;
+    int32_t offsets[ZONE_OFFSET_TABLE_MAX_OFFSETS];
+    uint8_t offsetCount;
+} ZoneOffsetTable;
+
+/* Allocates and fills offset table of zone for years from 'fromYear' to 'toYear' inclusive.
+ * Table should be released with freeZoneOffsetTable(), zone should stay valid while table is used.
+ * Params:
+ *  table – the table to init
+ *  zone – the zone
+ *  fromYear – the first year of the window, such as 2015
+ *  toYear – the last year of the window, such as 2035
+ * Returns: true if table has been filled, false on invalid window, allocation failure or too many distinct offsets*/
+bool initZoneOffsetTable(ZoneOffsetTable *table, const TimeZone *zone, int64_t fromYear, int64_t toYear);
+
+/* Same as resolveTimeZoneOffset() for the table zone. Inside the window lookup is a shift and a load,
+ * buckets with offset change and epoch seconds outside the window are resolved with resolveTimeZoneOffset()
+ * Returns: zone offset in seconds*/
+int32_t resolveTableTimeZoneOffset(int64_t epochSeconds, const ZoneOffsetTable *table);
+
+/* Releases table buckets, table can be initialized again*/
+void freeZoneOffsetTable(ZoneOffsetTable *table);
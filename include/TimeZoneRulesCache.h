@@ -0,0 +1,39 @@
+#pragma once
+
+#include "TimeZone.h"
+
+#if defined(ENABLE_TIME_ZONE_COMPRESSED_RULES)
+
+/* Compressed rules for each ZONE_LIST entry, generated by tools/TimeZoneDataGenerator.c with "-l varint".
+ * ZONE_LIST entries of this layout have no rules, alias points to rules of the canonical zone, NULL if zone has no rules*/
+extern const VarintTimeZoneRules *const ZONE_VARINT_RULES[];
+
+#elif defined(ENABLE_TIME_ZONE_COMPACT_RULES)
+
+/* Compact rules for each ZONE_LIST entry, generated by tools/TimeZoneDataGenerator.c with "-l compact".
+ * ZONE_LIST entries of this layout have no rules, alias points to rules of the canonical zone, NULL if zone has no rules*/
+extern const CompactTimeZoneRules *const ZONE_COMPACT_RULES[];
+
+/* Returns compact rules of ZONE_LIST zone or its copy, to be searched in place with resolveCompactTimeZoneOffset()
+ * without decoding the zone. NULL if zone is not in ZONE_LIST or has no rules*/
+const CompactTimeZoneRules *findCompactTimeZoneRules(const TimeZone *zone);
+
+#endif
+
+#if defined(ENABLE_TIME_ZONE_COMPRESSED_RULES) || defined(ENABLE_TIME_ZONE_COMPACT_RULES)
+
+/* Returns ZONE_LIST zone with rules decoded on first access, so zones that are never found cost no RAM.
+ * Decoded zone stays valid until freeDecodedTimeZones(), alias shares decoded rules with its canonical zone.
+ * Safe to call from several threads, zone decoded by two threads at once is kept once.
+ * Params:
+ *  zoneIndex – the index in ZONE_LIST
+ * Returns: decoded zone, ZONE_LIST entry without rules on allocation failure, NULL if index is out of range*/
+const TimeZone *getDecodedTimeZone(uint16_t zoneIndex);
+
+/* Releases all decoded zones, should not be called while decoded zones are used or decoded*/
+void freeDecodedTimeZones();
+
+/* Returns bytes allocated for decoded zones and their slot table*/
+size_t getDecodedTimeZonesSize();
+
+#endif
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "TimeZoneLoader.h"
+
+#ifdef ENABLE_TIME_ZONE_TZIF_LOADER
+
+#define ZONE_DATABASE_NO_READER (-1)
+
+#ifndef ZONE_DATABASE_MAX_READERS
+#define ZONE_DATABASE_MAX_READERS 64    // max count of threads registered as readers at the same time
+#endif
+
+/* Set of zones loaded from one zone info directory, such as new tzdata version installed while service is running.
+ * Readers reach the current database through atomically published pointer, replaced database is released only
+ * after all readers that could see it have left it (epoch based reclamation), so read path has no locks and no waits*/
+typedef struct ZoneDatabase {
+    uint32_t version;               // set on publish, increased with each published database
+    uint32_t retiredEpoch;          // reader epoch since which database is not reachable
+    struct ZoneDatabase *nextRetired;
+    uint16_t zoneCount;
+    const TimeZone *zones[];        // sorted by id
+} ZoneDatabase;
+
+/* Loads zones from TZif files of the directory into new unpublished database.
+ * Params:
+ *  directory – the zone info directory path, NULL for directory set with setZoneInfoDirectory()
+ *  zoneIds – the zone ids to load, NULL for ids of all ZONE_LIST zones
+ *  zoneCount – the count of zone ids, ignored when zone ids are NULL
+ * Returns: database with found zones, NULL when no zone has been loaded or on allocation failure*/
+ZoneDatabase *loadZoneDatabase(const char *directory, const char *const *zoneIds, uint16_t zoneCount);
+
+/* Releases database that has not been published, published database is released by reclaimZoneDatabases()*/
+void freeZoneDatabase(ZoneDatabase *database);
+
+/* Makes database current for readers that enter after this call, previous database is retired and released
+ * when no reader uses it. Should not be called concurrently with other publish or reclaim calls.
+ * Params:
+ *  database – the loaded database, NULL to retire current database on shutdown
+ * Returns: version of published database, 0 for NULL database*/
+uint32_t publishZoneDatabase(ZoneDatabase *database);
+
+/* Releases retired databases that are not used by any reader, called by publishZoneDatabase().
+ * Should not be called concurrently with other publish or reclaim calls.
+ * Returns: count of retired databases that are still used by readers*/
+uint16_t reclaimZoneDatabases();
+
+/* Takes reader slot for the calling thread, slot should be released with unregisterZoneDatabaseReader()
+ * Returns: reader slot, ZONE_DATABASE_NO_READER when all ZONE_DATABASE_MAX_READERS slots are used*/
+int32_t registerZoneDatabaseReader();
+
+void unregisterZoneDatabaseReader(int32_t reader);
+
+/* Starts read section, returned database and its zones stay valid until leaveZoneDatabase() of the same reader.
+ * Wait free: one announce store and two atomic loads, sections of one reader should not be nested.
+ * Params:
+ *  reader – the reader slot of the calling thread
+ * Returns: current database, NULL if no database has been published*/
+const ZoneDatabase *enterZoneDatabase(int32_t reader);
+
+/* Ends read section, zones of the database should not be used after this call*/
+void leaveZoneDatabase(int32_t reader);
+
+/* Finds zone by id in database with binary search, zone is used with all TimeZone functions inside read section.
+ * Returns: found zone or NULL*/
+const TimeZone *findDatabaseTimeZone(const ZoneDatabase *database, const char *zoneId);
+
+#endif
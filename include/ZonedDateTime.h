@@ -2,12 +2,13 @@
 
 #include "LocalDateTime.h"
 
-#define Z_DATE_TIME_COPY(zdt) ((ZonedDateTime){.dateTime = (zdt).dateTime, .zone = (zdt).zone, .offset = (zdt).offset})
+#define Z_DATE_TIME_COPY(zdt) ((ZonedDateTime){.dateTime = (zdt).dateTime, .zone = (zdt).zone, .offset = (zdt).offset, .externalZone = (zdt).externalZone})
 
 typedef struct ZonedDateTime {
     DateTime dateTime;
-    TimeZone zone;
+    ZoneHandle zone;    // see zoneHandleOf(), zone is resolved with getZonedDateTimeZone()
     int32_t offset;
+    const TimeZone *externalZone;   // zone of ZONE_HANDLE_EXTERNAL handle, should stay valid while zoned date-time is used
 } ZonedDateTime;
 
 
@@ -68,6 +69,24 @@ ZonedDateTime zonedDateTimeFrom(Date *date, Time *time, const TimeZone *zone);
  * Returns: the zoned date-time*/
 ZonedDateTime zonedDateTimeOfDateTime(DateTime *dateTime, const TimeZone *zone);
 
+/* Same as zonedDateTimeOfDateTime(), but local offsets are searched in zone rules precomputed by buildLocalZoneRules().
+ * Useful when many zoned date-times of the same zone are created from local wall-clock input.
+ * Params:
+ *  dateTime – the local date-time
+ *  zone – the time-zone, not NULL
+ *  localRules – the local rules built for the same zone, NULL to search zone rules directly
+ * Returns: the zoned date-time*/
+ZonedDateTime zonedDateTimeOfDateTimeWithRules(DateTime *dateTime, const TimeZone *zone, const LocalZoneRules *localRules);
+
+/* Obtains an initialized ZonedDateTime struct from a local date-time and the offset it was given with, such as by parsed zone name.
+ * In overlap provided offset selects the earlier or later instant of the local date-time.
+ * Params:
+ *  dateTime – the local date-time
+ *  zone – the time-zone, not NULL
+ *  offset – the offset in seconds
+ * Returns: the zoned date-time, uninitialized if zone can't have provided offset at local date-time*/
+ZonedDateTime zonedDateTimeOfDateTimeWithOffset(DateTime *dateTime, const TimeZone *zone, int32_t offset);
+
 /* Obtains an initialized ZonedDateTime struct from an Instant.
  * This creates a zoned date-time with the same instant as that specified.
  * Params:
@@ -76,6 +95,15 @@ ZonedDateTime zonedDateTimeOfDateTime(DateTime *dateTime, const TimeZone *zone);
  *  Returns: the zoned date-time*/
 ZonedDateTime zonedDateTimeOfInstant(Instant *instant, const TimeZone *zone);
 
+/* Same as zonedDateTimeOfInstant(), but zone rule lookup reuses the last transition window stored in cache.
+ * Useful for converting long runs of nearly sorted instants of the same zone.
+ * Params:
+ *  instant – the instant to create the date-time from
+ *  zone – the time-zone, not NULL
+ *  cache – the zero initialized lookup cache, NULL disables caching
+ *  Returns: the zoned date-time*/
+ZonedDateTime zonedDateTimeOfInstantCached(Instant *instant, const TimeZone *zone, ZoneTransitionCache *cache);
+
 /* Returns a copy of provided zoned date-time with a different time-zone.
  * This method changes the time-zone. This normally results in a change to the local date-time.
  * This method is based on retaining the same instant.
@@ -233,6 +261,10 @@ ZonedDateTime *zonedDateTimeMinusSeconds(ZonedDateTime *zonedDateTime, int64_t s
  * Returns: a ZonedDateTime struct based on this date-time with the milliseconds subtracted*/
 ZonedDateTime *zonedDateTimeMinusMillis(ZonedDateTime *zonedDateTime, int64_t millis);
 
+/* Returns the zone of zoned date-time, fixed offset zone has zoned date-time offset.
+ * Returns: zone copy, zone with NULL id for uninitialized zoned date-time*/
+TimeZone getZonedDateTimeZone(const ZonedDateTime *zonedDateTime);
+
 /* Checks if provided date-time is equal to another date-time.
  * The comparison is based on the offset date-time and the zone.
  * Params:
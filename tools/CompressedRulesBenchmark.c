@@ -0,0 +1,126 @@
+#include <getopt.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "GlobalDateTime.h"
+
+/* Compares rule data size of ZONE_LIST tables in each layout and measures varint decode time:
+ *  table   - TimeZoneRule tables with terminating entry, same as TimeZoneData.c
+ *  compact - CompactTimeZoneRules, 5 bytes per rule and offset palette
+ *  varint  - VarintTimeZoneRules, as generated with "-l varint"
+ * Decoded cache is the RAM of compressed build after zones are found, same as getDecodedTimeZonesSize()
+ * of library compiled with ENABLE_TIME_ZONE_COMPRESSED_RULES, table and varint data are read only.
+ * Build with tools/CMakeLists.txt: cmake -S tools -B build && cmake --build build
+ * Usage: ./build/CompressedRulesBenchmark [-z zoneId] [-n decodeRounds]*/
+
+#define DEFAULT_ZONE_ID "America/New_York"
+#define DEFAULT_DECODE_ROUNDS 1000
+#define MAX_RULE_COUNT 1024
+#define MAX_OFFSET_TYPES 64
+
+typedef struct PackedZone {
+    const TimeZone *zone;
+    VarintTimeZoneRules varintRules;
+    ZoneOffsetType offsetTypes[MAX_OFFSET_TYPES];
+} PackedZone;
+
+static bool isFirstTableUse(uint16_t zoneIndex) {    // aliases and zones with same transitions share one table
+    const TimeZone *zone = getTimeZoneByIndex(zoneIndex);
+    for (uint16_t i = 0; i < zoneIndex; i++) {
+        if (getTimeZoneByIndex(i)->rules == zone->rules) return false;
+    }
+    return true;
+}
+
+static size_t decodedZoneSize(const TimeZone *zone) {    // decoded zone of TimeZoneRulesCache.c
+    return sizeof(TimeZone) + (zone->ruleCount + 1) * sizeof(TimeZoneRule);
+}
+
+int main(int argc, char *argv[]) {
+    const char *zoneId = DEFAULT_ZONE_ID;
+    uint32_t decodeRounds = DEFAULT_DECODE_ROUNDS;
+
+    int option;
+    while ((option = getopt(argc, argv, "z:n:")) != -1) {
+        switch (option) {
+            case 'z': zoneId = optarg; break;
+            case 'n': decodeRounds = (uint32_t) strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "Usage: %s [-z zoneId] [-n decodeRounds]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    const TimeZone *selectedZone = findTimeZone(zoneId);
+    PackedZone *packedZones = malloc(getTimeZoneCount() * sizeof(PackedZone));
+    uint8_t *varintData = malloc((size_t) getTimeZoneCount() * MAX_RULE_COUNT * VARINT_RULE_MAX_LENGTH);
+    if (selectedZone == NULL || selectedZone->ruleCount == 0 || packedZones == NULL || varintData == NULL) {
+        fprintf(stderr, "Zone '%s' not found or has no rules\n", zoneId);
+        return EXIT_FAILURE;
+    }
+
+    uint32_t tableCount = 0;
+    uint32_t ruleCount = 0;
+    size_t tableSize = 0;
+    size_t compactSize = 0;
+    size_t varintSize = 0;
+    size_t decodedSize = 0;
+    uint32_t dataLength = 0;
+    const PackedZone *selectedPackedZone = NULL;
+    for (uint16_t i = 0; i < getTimeZoneCount(); i++) {
+        const TimeZone *zone = getTimeZoneByIndex(i);
+        if (zone->ruleCount == 0 || zone->ruleCount > MAX_RULE_COUNT || !isFirstTableUse(i)) continue;
+
+        PackedZone *packedZone = &packedZones[tableCount++];
+        packedZone->zone = zone;
+        uint8_t *data = varintData + dataLength;
+        if (!packVarintTimeZoneRules(zone->rules, zone->ruleCount, &packedZone->varintRules, data, MAX_RULE_COUNT * VARINT_RULE_MAX_LENGTH,
+                                     packedZone->offsetTypes, MAX_OFFSET_TYPES)) {
+            fprintf(stderr, "Can't pack rules of %s\n", zone->id);
+            return EXIT_FAILURE;
+        }
+        const VarintTimeZoneRules *varintRules = &packedZone->varintRules;
+        dataLength += varintRules->dataLength;
+        ruleCount += zone->ruleCount;
+        tableSize += (zone->ruleCount + 1) * sizeof(TimeZoneRule);
+        compactSize += sizeof(CompactTimeZoneRules) + zone->ruleCount * (sizeof(uint32_t) + sizeof(uint8_t)) +
+                       varintRules->offsetTypeCount * sizeof(ZoneOffsetType);
+        varintSize += sizeof(VarintTimeZoneRules) + varintRules->dataLength + varintRules->offsetTypeCount * sizeof(ZoneOffsetType);
+        decodedSize += decodedZoneSize(zone);
+        if (zone->rules == selectedZone->rules) selectedPackedZone = packedZone;
+    }
+    size_t linkSize = getTimeZoneCount() * sizeof(const VarintTimeZoneRules *);    // ZONE_VARINT_RULES
+    size_t slotsSize = getTimeZoneCount() * sizeof(void *);                         // decoded zone slots
+
+    printf("%u zones, %u rule tables, %u rules\n", getTimeZoneCount(), tableCount, ruleCount);
+    printf("%-8s %10zu bytes  %5.2f bytes/rule\n", "table", tableSize, (double) tableSize / ruleCount);
+    printf("%-8s %10zu bytes  %5.2f bytes/rule\n", "compact", compactSize, (double) compactSize / ruleCount);
+    printf("%-8s %10zu bytes  %5.2f bytes/rule\n", "varint", varintSize + linkSize, (double) (varintSize + linkSize) / ruleCount);
+
+    static TimeZoneRule decodedRules[MAX_RULE_COUNT];
+    int64_t checksum = 0;
+    clock_t start = clock();
+    for (uint32_t round = 0; round < decodeRounds; round++) {
+        for (uint32_t i = 0; i < tableCount; i++) {
+            unpackVarintTimeZoneRules(&packedZones[i].varintRules, decodedRules, MAX_RULE_COUNT);
+            checksum += decodedRules[packedZones[i].zone->ruleCount - 1].transition;
+        }
+    }
+    double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("decode   %8.2f us/zone  %5.2f ns/rule  (checksum %lld)\n",
+           seconds * 1e6 / ((double) decodeRounds * tableCount), seconds * 1e9 / ((double) decodeRounds * ruleCount), (long long) checksum);
+
+    start = clock();
+    for (uint32_t round = 0; round < decodeRounds; round++) {
+        unpackVarintTimeZoneRules(&selectedPackedZone->varintRules, decodedRules, MAX_RULE_COUNT);
+        checksum += decodedRules[0].transition;
+    }
+    seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("decode %s, %u rules: %.2f us\n", selectedZone->id, selectedZone->ruleCount, seconds * 1e6 / decodeRounds);
+
+    printf("decoded cache, %s: %zu bytes\n", selectedZone->id, slotsSize + decodedZoneSize(selectedZone));
+    printf("decoded cache, every table: %zu bytes\n", slotsSize + decodedSize);
+    free(packedZones);
+    free(varintData);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,83 @@
+#include <getopt.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "GlobalDateTime.h"
+
+/* Compares conversion of the same random epoch days of years 1900 to 2100 to year, month, day and week day:
+ *  dateOfEpochDay - one Date per day, fields copied to arrays
+ *  batch          - dateOfEpochDayBatch() with each kernel supported by CPU
+ * Build with tools/CMakeLists.txt: cmake -S tools -B build && cmake --build build
+ * Usage: ./build/DateBatchBenchmark [-n dayCount] [-r rounds]*/
+
+#define DEFAULT_DAY_COUNT 65536
+#define DEFAULT_ROUNDS 1000
+#define EPOCH_DAY_1900 (-25567)
+#define DAYS_1900_TO_2100 73049
+
+static const char *const KERNEL_NAMES[] = {"scalar", "avx2", "avx512"};
+
+static double nanosPerDay(clock_t start, uint32_t rounds, size_t dayCount) {
+    return (double) (clock() - start) / CLOCKS_PER_SEC * 1e9 / ((double) rounds * dayCount);
+}
+
+int main(int argc, char *argv[]) {
+    size_t dayCount = DEFAULT_DAY_COUNT;
+    uint32_t rounds = DEFAULT_ROUNDS;
+
+    int option;
+    while ((option = getopt(argc, argv, "n:r:")) != -1) {
+        switch (option) {
+            case 'n': dayCount = (size_t) strtoul(optarg, NULL, 10); break;
+            case 'r': rounds = (uint32_t) strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "Usage: %s [-n dayCount] [-r rounds]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    int32_t *epochDays = malloc(dayCount * sizeof(int32_t));
+    int32_t *years = malloc(dayCount * sizeof(int32_t));
+    uint8_t *months = malloc(dayCount);
+    uint8_t *days = malloc(dayCount);
+    uint8_t *weekDays = malloc(dayCount);
+    if (dayCount == 0 || epochDays == NULL || years == NULL || months == NULL || days == NULL || weekDays == NULL) {
+        fprintf(stderr, "Can't allocate %zu days\n", dayCount);
+        return EXIT_FAILURE;
+    }
+    srand(1);
+    for (size_t i = 0; i < dayCount; i++) {
+        epochDays[i] = EPOCH_DAY_1900 + rand() % DAYS_1900_TO_2100;
+    }
+
+    int64_t checksum = 0;
+    clock_t start = clock();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < dayCount; i++) {
+            Date date = dateOfEpochDay(epochDays[i]);
+            years[i] = (int32_t) date.year;
+            months[i] = (uint8_t) date.month;
+            days[i] = (uint8_t) date.day;
+            weekDays[i] = (uint8_t) date.weekDay;
+        }
+        checksum += years[round % dayCount] + days[round % dayCount];
+    }
+    printf("%-15s %6.2f ns/day\n", "dateOfEpochDay", nanosPerDay(start, rounds, dayCount));
+
+    for (DateBatchKernel kernel = DATE_BATCH_SCALAR; kernel <= detectDateBatchKernel(); kernel++) {
+        start = clock();
+        for (uint32_t round = 0; round < rounds; round++) {
+            dateOfEpochDayBatchWithKernel(kernel, epochDays, dayCount, years, months, days, weekDays);
+            checksum += years[round % dayCount] + days[round % dayCount];
+        }
+        printf("batch %-9s %6.2f ns/day\n", KERNEL_NAMES[kernel], nanosPerDay(start, rounds, dayCount));
+    }
+    printf("checksum %lld\n", (long long) checksum);
+
+    free(epochDays);
+    free(years);
+    free(months);
+    free(days);
+    free(weekDays);
+    return EXIT_SUCCESS;
+}
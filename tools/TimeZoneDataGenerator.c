@@ -0,0 +1,953 @@
+#define _XOPEN_SOURCE 700
+
+#include <ftw.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GlobalDateTime.h"
+#include "TimeZoneIdHash.h"
+#include "TimeZoneNameHash.h"
+
+/* Generates TimeZoneData.c and extern declaration blocks of TimeZoneNames.h and TimeZoneRules.h from TZif files,
+ * such as compiled by zic from IANA tzdata sources to /usr/share/zoneinfo.
+ * Zone ids are taken from current ZONE_LIST, or with "-a" from all TZif files in the zone info directory.
+ * Zone names are taken from current compiled zone with the same id, new zones use abbreviations from the file.
+ * Rules keep transitions inside the year window, transitions after the last one in the file are calculated from
+ * the POSIX TZ footer rule, that is also emitted as recurring rule for instants after the window.
+ * Layouts:
+ *  table   - TimeZoneRule tables, same as current TimeZoneData.c
+ *  compact - CompactTimeZoneRules tables and ZONE_COMPACT_RULES, zone list has no rules,
+ *            library should be compiled with ENABLE_TIME_ZONE_COMPACT_RULES to decode rules on first access
+ *  varint  - VarintTimeZoneRules tables and ZONE_VARINT_RULES, zone list has no rules,
+ *            library should be compiled with ENABLE_TIME_ZONE_COMPRESSED_RULES to decode rules on first access
+ * Zone id hash tables are emitted for all layouts, zone count should be equal to ZONE_ID_HASH_SLOT_COUNT.
+ * With "-n" hash is not emitted and library should be compiled with ENABLE_TIME_ZONE_SUBSET (binary search).
+ * Zone name hash is emitted for all layouts, names of canonical zones are mapped to zone ids, so it does not depend on subset.
+ * Build with tools/CMakeLists.txt: cmake -S tools -B build && cmake --build build
+ * Usage: ./build/TimeZoneDataGenerator [-d zoneInfoDir] [-o rootDir] [-f fromYear] [-t toYear] [-l table|compact|varint] [-r referenceYear] [-a] [-n]*/
+
+#define MAX_ZONE_COUNT 1024
+#define SYMBOL_MAX_LENGTH 64
+#define FOOTER_MAX_LENGTH 64
+#define VERSION_MAX_LENGTH 16
+#define COMMAND_LINE_MAX_LENGTH 512
+#define VALUES_PER_LINE 16
+#define NO_ZONE_INDEX UINT16_MAX
+#define MAX_NAME_CANDIDATE_COUNT (MAX_ZONE_COUNT * 4)
+
+#define DEFAULT_FROM_YEAR 1970
+#define DEFAULT_TO_YEAR 2071
+#define DEFAULT_REFERENCE_YEAR 2022   // zone utcOffset is the offset at July 1 of this year
+
+typedef enum DataLayout {
+    LAYOUT_TABLE,
+    LAYOUT_COMPACT,
+    LAYOUT_VARINT
+} DataLayout;
+
+typedef struct GeneratedZone {
+    char id[ZONE_INFO_PATH_MAX_LENGTH];
+    const TimeZone *loadedZone;
+    char footer[FOOTER_MAX_LENGTH];     // POSIX TZ string, empty if absent
+    TimeZoneRule *rules;
+    uint16_t ruleCount;
+    uint16_t linkIndex;         // canonical zone index, alias has no own tables
+    uint16_t rulesZoneIndex;    // zone which table has the same transitions, NO_ZONE_INDEX if no rules
+    char rulesSymbol[SYMBOL_MAX_LENGTH];
+    char namesSymbol[SYMBOL_MAX_LENGTH];
+    char recurringSymbol[SYMBOL_MAX_LENGTH];    // empty if no daylight time recurring rule
+} GeneratedZone;
+
+typedef struct HashBucket {
+    uint16_t bucketIndex;
+    uint16_t zoneCount;
+    uint16_t zoneIndexes[16];
+} HashBucket;
+
+typedef struct NameCandidate {
+    ZoneNameCandidate candidate;
+    uint32_t zoneCount;         // zones using the name with this offset, aliases included
+    uint32_t aliasCount;        // aliases of the candidate zone
+    bool isPreferred;
+} NameCandidate;
+
+/* Primary zones of common CLDR metazones, so shared names resolve to the usual meaning, such as "CST" to Chicago.
+ * Other candidate zones are the zones with most aliases*/
+static const char *const PREFERRED_NAME_ZONES[] = {
+        "Africa/Johannesburg", "Africa/Lagos", "Africa/Maputo", "Africa/Nairobi", "America/Anchorage", "America/Chicago",
+        "America/Denver", "America/Halifax", "America/Los_Angeles", "America/New_York", "America/Sao_Paulo", "America/St_Johns",
+        "Asia/Jakarta", "Asia/Karachi", "Asia/Kolkata", "Asia/Seoul", "Asia/Shanghai", "Asia/Tokyo", "Atlantic/Canary",
+        "Australia/Adelaide", "Australia/Perth", "Australia/Sydney", "Europe/Bucharest", "Europe/London", "Europe/Moscow",
+        "Europe/Paris", "Pacific/Auckland", "Pacific/Honolulu"};
+
+static GeneratedZone zones[MAX_ZONE_COUNT];
+static uint32_t zoneCount = 0;
+static const char *zoneInfoDirectory = ZONE_INFO_DEFAULT_DIRECTORY;
+static char tzdataVersion[VERSION_MAX_LENGTH] = "unknown";
+static char commandLine[COMMAND_LINE_MAX_LENGTH] = "TimeZoneDataGenerator";
+
+static void addZoneId(const char *zoneId) {
+    if (zoneCount == MAX_ZONE_COUNT || strlen(zoneId) >= ZONE_INFO_PATH_MAX_LENGTH) {
+        fprintf(stderr, "Skipped zone: %s\n", zoneId);
+        return;
+    }
+    strcpy(zones[zoneCount++].id, zoneId);
+}
+
+static int addZoneFile(const char *path, const struct stat *status, int type, struct FTW *ftw) {     // nftw() callback
+    (void) status;
+    (void) ftw;
+    const char *zoneId = path + strlen(zoneInfoDirectory) + 1;
+    if (type != FTW_F) return 0;
+    if (strncmp(zoneId, "posix/", 6) == 0 || strncmp(zoneId, "right/", 6) == 0) return 0;    // duplicated trees
+    if (strcmp(zoneId, "posixrules") == 0 || strcmp(zoneId, "localtime") == 0 || strcmp(zoneId, "Factory") == 0) return 0;
+    if (strchr(zoneId, '.') != NULL) return 0;    // zone.tab, tzdata.zi and other text files
+    addZoneId(zoneId);
+    return 0;
+}
+
+static int compareZoneIds(const void *first, const void *second) {
+    return strcmp(((const GeneratedZone *) first)->id, ((const GeneratedZone *) second)->id);
+}
+
+static void toSymbol(const char *text, const char *suffix, char *symbol) {    // "America/New_York" -> "AMERICA_NEW_YORK"
+    uint32_t length = 0;
+    for (; *text != '\0' && length < SYMBOL_MAX_LENGTH - strlen(suffix) - 1; text++) {
+        char ch = *text;
+        symbol[length++] = (ch >= 'a' && ch <= 'z') ? (char) (ch - 'a' + 'A') : ((ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9')) ? ch : '_';
+    }
+    strcpy(symbol + length, suffix);
+}
+
+static const char *findCityName(const char *zoneId) {
+    const char *city = strrchr(zoneId, '/');
+    return city != NULL ? city + 1 : zoneId;
+}
+
+static void readFooter(GeneratedZone *zone) {   // TZ string is the last line of the file
+    char path[ZONE_INFO_PATH_MAX_LENGTH * 2];
+    snprintf(path, sizeof(path), "%s/%s", zoneInfoDirectory, zone->id);
+    zone->footer[0] = '\0';
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return;
+
+    char tail[FOOTER_MAX_LENGTH + 1];
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    long length = size < FOOTER_MAX_LENGTH ? size : FOOTER_MAX_LENGTH;
+    fseek(file, size - length, SEEK_SET);
+    length = (long) fread(tail, 1, length, file);
+    fclose(file);
+
+    if (length < 2 || tail[length - 1] != '\n') return;
+    long start = length - 1;
+    while (start > 0 && tail[start - 1] != '\n') {     // binary data before the footer has '\0' bytes, so no strrchr()
+        start--;
+    }
+    if (start > 0) {
+        memcpy(zone->footer, tail + start, length - 1 - start);
+        zone->footer[length - 1 - start] = '\0';
+    }
+}
+
+static void readTzdataVersion() {     // "# version 2025b" first line of tzdata.zi, or "+VERSION" file of some distributions
+    static const char *const VERSION_FILES[] = {"tzdata.zi", "+VERSION"};
+    for (uint32_t i = 0; i < ARRAY_SIZE(VERSION_FILES); i++) {
+        char path[ZONE_INFO_PATH_MAX_LENGTH * 2];
+        snprintf(path, sizeof(path), "%s/%s", zoneInfoDirectory, VERSION_FILES[i]);
+        FILE *file = fopen(path, "r");
+        if (file == NULL) continue;
+
+        char line[64];
+        char version[VERSION_MAX_LENGTH];
+        bool isFound = fgets(line, sizeof(line), file) != NULL &&
+                       (sscanf(line, "# version %15s", version) == 1 || (i > 0 && sscanf(line, "%15s", version) == 1));
+        fclose(file);
+        if (isFound) {
+            strcpy(tzdataVersion, version);
+            return;
+        }
+    }
+}
+
+static void buildCommandLine(int argc, char *argv[]) {     // recorded in generated file header
+    for (int i = 1; i < argc; i++) {
+        size_t length = strlen(commandLine);
+        snprintf(commandLine + length, sizeof(commandLine) - length, " %s", argv[i]);
+    }
+}
+
+static bool isRecurringRuleTransition(const TimeZone *loadedZone, const TimeZoneRule *rule) {
+    TimeZone recurringZone = {.recurringRule = loadedZone->recurringRule};    // no rules, footer applies to any instant
+    TimeZoneRule decodedRules[2];
+    ZoneTransition transition = findRecurringRuleTransition(rule->transition, &recurringZone, decodedRules);
+    return transition.after != NULL &&
+           transition.after->transition == rule->transition &&
+           transition.after->gmtOffset == rule->gmtOffset &&
+           transition.after->isDaylightTime == rule->isDaylightTime;
+}
+
+static uint32_t findIrregularRulesEnd(const TimeZone *loadedZone, int64_t toEpoch) {   // "Asia/Gaza" predicted transitions differ from footer
+    uint32_t rulesEnd = 0;
+    for (uint32_t i = 0; i < loadedZone->ruleCount; i++) {
+        const TimeZoneRule *rule = &loadedZone->rules[i];
+        if (rule->transition >= toEpoch && !isRecurringRuleTransition(loadedZone, rule)) {
+            rulesEnd = i + 1;
+        }
+    }
+    return rulesEnd;
+}
+
+static bool loadZoneRules(GeneratedZone *zone, int64_t fromEpoch, int64_t toEpoch) {
+    const TimeZone *loadedZone = loadTimeZone(zone->id);
+    if (loadedZone == NULL) return false;
+    zone->loadedZone = loadedZone;
+    readFooter(zone);
+
+    // file transitions after the window are kept while the recurring rule can't reproduce them
+    uint32_t irregularRulesEnd = findIrregularRulesEnd(loadedZone, toEpoch);
+
+    uint32_t capacity = loadedZone->ruleCount + 2 * (uint32_t) ((toEpoch - fromEpoch) / (SECONDS_PER_DAY * 365) + 2);
+    zone->rules = malloc(capacity * sizeof(TimeZoneRule));
+    if (zone->rules == NULL) return false;
+
+    zone->ruleCount = 0;
+    int64_t lastTransition = fromEpoch - 1;
+    for (uint32_t i = 0; i < loadedZone->ruleCount; i++) {
+        const TimeZoneRule *rule = &loadedZone->rules[i];
+        if (rule->transition >= fromEpoch && (rule->transition < toEpoch || i < irregularRulesEnd)) {
+            zone->rules[zone->ruleCount++] = *rule;
+        }
+        lastTransition = rule->transition > lastTransition ? rule->transition : lastTransition;
+    }
+
+    TimeZoneRule decodedRules[2];   // extend rules after the last transition in the file
+    for (;;) {
+        ZoneTransition transition = findRecurringRuleTransition(lastTransition + 1, loadedZone, decodedRules);
+        if (transition.after == NULL || transition.after->transition >= toEpoch || zone->ruleCount == capacity) break;
+        if (transition.after->transition >= fromEpoch) {
+            zone->rules[zone->ruleCount++] = *transition.after;
+        }
+        lastTransition = transition.after->transition;
+    }
+    return true;
+}
+
+static bool isSameNames(const char *const *names, const char *const *otherNames) {
+    for (uint32_t i = 0; i < 4; i++) {
+        if (strcmp(names[i], otherNames[i]) != 0) return false;
+    }
+    return true;
+}
+
+static void resolveNamesSymbol(uint32_t zoneIndex) {    // "CET" -> "CET_ZONE_NAMES", city is appended on conflict
+    GeneratedZone *zone = &zones[zoneIndex];
+    const char *const *names = zone->loadedZone->names;
+    char base[SYMBOL_MAX_LENGTH];
+    bool isNumeric = names[ZONE_SHORT_NAME_STD_INDEX][0] == '+' || names[ZONE_SHORT_NAME_STD_INDEX][0] == '-';   // "+03" -> "GMT_03"
+    snprintf(base, sizeof(base), "%s%s", isNumeric ? "GMT" : "", names[ZONE_SHORT_NAME_STD_INDEX]);
+    toSymbol(base, "_ZONE_NAMES", zone->namesSymbol);
+    for (uint32_t i = 0; i < zoneIndex; i++) {
+        if (strcmp(zones[i].namesSymbol, zone->namesSymbol) == 0 && !isSameNames(zones[i].loadedZone->names, names)) {
+            snprintf(base + strlen(base), sizeof(base) - strlen(base), "_%s", findCityName(zone->id));
+            toSymbol(base, "_ZONE_NAMES", zone->namesSymbol);
+            return;
+        }
+    }
+}
+
+static void findRecurringBase(const GeneratedZone *zone, char *base) {     // "CET-1CEST,M3.5.0,M10.5.0/3" -> "CET"
+    uint32_t length = 0;
+    const char *text = zone->footer;
+    while (((*text >= 'A' && *text <= 'Z') || (*text >= 'a' && *text <= 'z')) && length < SYMBOL_MAX_LENGTH - 1) {
+        base[length++] = *text++;
+    }
+    base[length] = '\0';
+    if (length == 0) {  // quoted numeric abbreviation, such as "<-02>2<-01>,M3.5.0/-1,M10.5.0/0"
+        strcpy(base, zone->loadedZone->names[ZONE_SHORT_NAME_STD_INDEX]);
+    }
+}
+
+static uint32_t countFooterUses(const char *footer) {
+    uint32_t useCount = 0;
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        useCount += (zones[i].loadedZone->recurringRule != NULL && strcmp(zones[i].footer, footer) == 0);
+    }
+    return useCount;
+}
+
+/* Zones with the same footer share one rule, "CET-1CEST,M3.5.0,M10.5.0/3" -> "CET_RECURRING_RULE".
+ * Most used footer of the same abbreviation keeps the plain symbol, others get the city of their first canonical zone appended*/
+static void resolveRecurringSymbol(uint32_t zoneIndex) {
+    GeneratedZone *zone = &zones[zoneIndex];
+    zone->recurringSymbol[0] = '\0';
+    if (zone->loadedZone->recurringRule == NULL) return;
+    for (uint32_t i = 0; i < zoneIndex; i++) {
+        if (zones[i].recurringSymbol[0] != '\0' && strcmp(zones[i].footer, zone->footer) == 0) {
+            strcpy(zone->recurringSymbol, zones[i].recurringSymbol);
+            return;
+        }
+    }
+
+    char base[SYMBOL_MAX_LENGTH];
+    char otherBase[SYMBOL_MAX_LENGTH];
+    findRecurringBase(zone, base);
+    uint32_t useCount = countFooterUses(zone->footer);
+    bool isPlainSymbol = true;
+    for (uint32_t i = 0; i < zoneCount && isPlainSymbol; i++) {
+        if (zones[i].loadedZone->recurringRule == NULL || strcmp(zones[i].footer, zone->footer) == 0) continue;
+        findRecurringBase(&zones[i], otherBase);
+        if (strcmp(otherBase, base) == 0) {
+            uint32_t otherUseCount = countFooterUses(zones[i].footer);
+            isPlainSymbol = useCount > otherUseCount || (useCount == otherUseCount && zoneIndex < i);
+        }
+    }
+    if (!isPlainSymbol) {
+        snprintf(base + strlen(base), sizeof(base) - strlen(base), "_%s", findCityName(zones[zone->linkIndex].id));
+    }
+    toSymbol(base, "_RECURRING_RULE", zone->recurringSymbol);
+}
+
+static bool isSameRules(const GeneratedZone *zone, const GeneratedZone *other) {
+    if (zone->ruleCount != other->ruleCount) return false;
+    for (uint32_t i = 0; i < zone->ruleCount; i++) {
+        if (zone->rules[i].transition != other->rules[i].transition || zone->rules[i].gmtOffset != other->rules[i].gmtOffset ||
+            zone->rules[i].isDaylightTime != other->rules[i].isDaylightTime) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t countAliases(uint32_t zoneIndex) {
+    uint32_t aliasCount = 0;
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        aliasCount += (zones[i].linkIndex == zoneIndex && i != zoneIndex);
+    }
+    return aliasCount;
+}
+
+static void resolveRuleTables(const char *suffix) {   // canonical zones with same transitions share one table
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        GeneratedZone *zone = &zones[i];
+        zone->rulesZoneIndex = NO_ZONE_INDEX;
+        toSymbol(zone->id, suffix, zone->rulesSymbol);
+        if (zone->ruleCount == 0 || zone->linkIndex != i) continue;
+
+        zone->rulesZoneIndex = i;
+        for (uint32_t j = 0; j < i; j++) {
+            if (zones[j].rulesZoneIndex == j && isSameRules(zone, &zones[j])) {
+                zone->rulesZoneIndex = j;
+                break;
+            }
+        }
+        uint32_t tableZoneIndex = zone->rulesZoneIndex;     // table of the zone with more aliases is kept
+        if (tableZoneIndex != i && countAliases(i) > countAliases(tableZoneIndex)) {
+            for (uint32_t j = 0; j < i; j++) {
+                if (zones[j].rulesZoneIndex == tableZoneIndex) zones[j].rulesZoneIndex = i;
+            }
+            zone->rulesZoneIndex = i;
+        }
+    }
+}
+
+static const GeneratedZone *findTableZone(const GeneratedZone *zone) {     // alias uses table of its link target
+    const GeneratedZone *canonicalZone = &zones[zone->linkIndex];
+    return canonicalZone->rulesZoneIndex == NO_ZONE_INDEX ? NULL : &zones[canonicalZone->rulesZoneIndex];
+}
+
+static const GeneratedZone *findRecurringZone(const GeneratedZone *zone) {
+    const GeneratedZone *canonicalZone = &zones[zone->linkIndex];
+    return canonicalZone->recurringSymbol[0] == '\0' ? NULL : canonicalZone;
+}
+
+
+static bool isFirstNamesUse(uint32_t zoneIndex) {
+    for (uint32_t i = 0; i < zoneIndex; i++) {
+        if (strcmp(zones[i].namesSymbol, zones[zoneIndex].namesSymbol) == 0) return false;
+    }
+    return true;
+}
+
+static bool isFirstRecurringUse(uint32_t zoneIndex) {
+    if (zones[zoneIndex].recurringSymbol[0] == '\0') return false;
+    for (uint32_t i = 0; i < zoneIndex; i++) {
+        if (strcmp(zones[i].recurringSymbol, zones[zoneIndex].recurringSymbol) == 0) return false;
+    }
+    return true;
+}
+
+static int compareRecurringSymbols(const void *first, const void *second) {
+    return strcmp(zones[*(const uint16_t *) first].recurringSymbol, zones[*(const uint16_t *) second].recurringSymbol);
+}
+
+static uint32_t sortRecurringZones(uint16_t *zoneIndexes) {     // first zone for each recurring rule, by symbol
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        if (isFirstRecurringUse(i)) zoneIndexes[count++] = i;
+    }
+    qsort(zoneIndexes, count, sizeof(uint16_t), compareRecurringSymbols);
+    return count;
+}
+
+static bool isUniversalNames(const char *symbol) {  // used by UTC and GMT constants without time zone support
+    return strcmp(symbol, "UTC_ZONE_NAMES") == 0 || strcmp(symbol, "GMT_ZONE_NAMES") == 0;
+}
+
+static void printNames(FILE *file, const GeneratedZone *zone) {
+    const char *const *names = zone->loadedZone->names;
+    int indent = fprintf(file, "const char *const %s[] = {", zone->namesSymbol);
+    fprintf(file, "\"%s\", \"%s\",\n", names[ZONE_LONG_NAME_STD_INDEX], names[ZONE_SHORT_NAME_STD_INDEX]);
+    fprintf(file, "%*s\"%s\", \"%s\"};\n\n", indent, "", names[ZONE_LONG_NAME_DTS_INDEX], names[ZONE_SHORT_NAME_DTS_INDEX]);
+}
+
+static void printRecurringDate(FILE *file, const char *name, const ZoneRecurringDate *date) {
+    static const char *const DATE_TYPES[] = {"RECURRING_DATE_MONTH_WEEK_DAY", "RECURRING_DATE_JULIAN_DAY", "RECURRING_DATE_ZERO_BASED_DAY"};
+    fprintf(file, "  .%s = {.type = %s, .month = %u, .week = %u, .day = %u, .secondOfDay = %d}", name,
+            DATE_TYPES[date->type], date->month, date->week, date->day, date->secondOfDay);
+}
+
+static void printRecurringRule(FILE *file, const GeneratedZone *zone) {
+    const ZoneRecurringRule *rule = zone->loadedZone->recurringRule;
+    fprintf(file, "const ZoneRecurringRule %s = {  // %s\n", zone->recurringSymbol, zone->footer);
+    fprintf(file, "  .standardOffset = %d, .daylightOffset = %d, .hasDaylightTime = true,\n", rule->standardOffset, rule->daylightOffset);
+    printRecurringDate(file, "daylightStart", &rule->daylightStart);
+    fprintf(file, ",\n");
+    printRecurringDate(file, "daylightEnd", &rule->daylightEnd);
+    fprintf(file, "};\n\n");
+}
+
+static void printRuleTable(FILE *file, const GeneratedZone *zone) {
+    fprintf(file, "const TimeZoneRule %s[] = {\n", zone->rulesSymbol);
+    fprintf(file, " #ifdef ENABLE_TIME_ZONE_HISTORIC_RULES\n");
+    for (uint32_t i = 0; i < zone->ruleCount; i++) {
+        const TimeZoneRule *rule = &zone->rules[i];
+        fprintf(file, "  {.gmtOffset = %d, .isDaylightTime = %s, .transition = %lld},\n",
+                rule->gmtOffset, rule->isDaylightTime ? "true" : "false", (long long) rule->transition);
+    }
+    fprintf(file, "   #endif\n");
+    fprintf(file, "  {.transition = 0}};\n\n");
+}
+
+static void printValues(FILE *file, const char *declaration, const char *comment, const uint32_t *values, uint32_t count) {
+    fprintf(file, "%s = {%s", declaration, comment);
+    for (uint32_t i = 0; i < count; i++) {
+        fprintf(file, "%s%u%s", (i % VALUES_PER_LINE == 0) ? "\n        " : " ", values[i], (i + 1 < count) ? "," : "");
+    }
+    fprintf(file, "\n};\n");
+}
+
+static bool printCompactRuleTable(FILE *file, const GeneratedZone *zone) {
+    CompactTimeZoneRules compactRules;
+    uint32_t *transitionDeltas = malloc(zone->ruleCount * sizeof(uint32_t));
+    uint8_t *offsetTypeIndexes = malloc(zone->ruleCount);
+    ZoneOffsetType offsetTypes[UINT8_MAX];
+    bool isPacked = transitionDeltas != NULL && offsetTypeIndexes != NULL &&
+                    packTimeZoneRules(zone->rules, zone->ruleCount, &compactRules, transitionDeltas, offsetTypeIndexes, offsetTypes, UINT8_MAX);
+    if (isPacked) {
+        char base[SYMBOL_MAX_LENGTH];
+        char declaration[SYMBOL_MAX_LENGTH * 2];
+        toSymbol(zone->id, "", base);
+
+        snprintf(declaration, sizeof(declaration), "static const uint32_t %s_TRANSITION_DELTAS[]", base);
+        printValues(file, declaration, "", transitionDeltas, zone->ruleCount);
+        for (uint32_t i = 0; i < zone->ruleCount; i++) {
+            transitionDeltas[i] = offsetTypeIndexes[i];     // reuse buffer for printing
+        }
+        snprintf(declaration, sizeof(declaration), "\nstatic const uint8_t %s_OFFSET_TYPE_INDEXES[]", base);
+        printValues(file, declaration, "", transitionDeltas, zone->ruleCount);
+        fprintf(file, "\nstatic const ZoneOffsetType %s_OFFSET_TYPES[] = {\n", base);
+        for (uint32_t i = 0; i < compactRules.offsetTypeCount; i++) {
+            fprintf(file, "        {.gmtOffset = %d, .isDaylightTime = %s},\n", offsetTypes[i].gmtOffset, offsetTypes[i].isDaylightTime ? "true" : "false");
+        }
+        fprintf(file, "};\n\n");
+        fprintf(file, "const CompactTimeZoneRules %s = {.baseTransition = %lld, .transitionDeltas = %s_TRANSITION_DELTAS,\n",
+                zone->rulesSymbol, (long long) compactRules.baseTransition, base);
+        fprintf(file, "  .offsetTypeIndexes = %s_OFFSET_TYPE_INDEXES, .offsetTypes = %s_OFFSET_TYPES, .ruleCount = %u, .offsetTypeCount = %u};\n\n",
+                base, base, compactRules.ruleCount, compactRules.offsetTypeCount);
+    } else {
+        fprintf(stderr, "Can't pack rules of %s\n", zone->id);
+    }
+    free(transitionDeltas);
+    free(offsetTypeIndexes);
+    return isPacked;
+}
+
+static bool printVarintRuleTable(FILE *file, const GeneratedZone *zone) {
+    VarintTimeZoneRules varintRules;
+    uint32_t dataCapacity = zone->ruleCount * VARINT_RULE_MAX_LENGTH;
+    uint8_t *data = malloc(dataCapacity);
+    uint32_t *values = malloc(dataCapacity * sizeof(uint32_t));
+    ZoneOffsetType offsetTypes[UINT8_MAX];
+    bool isPacked = data != NULL && values != NULL &&
+                    packVarintTimeZoneRules(zone->rules, zone->ruleCount, &varintRules, data, dataCapacity, offsetTypes, UINT8_MAX);
+    if (isPacked) {
+        char base[SYMBOL_MAX_LENGTH];
+        char declaration[SYMBOL_MAX_LENGTH * 2];
+        toSymbol(zone->id, "", base);
+
+        for (uint32_t i = 0; i < varintRules.dataLength; i++) {
+            values[i] = data[i];
+        }
+        snprintf(declaration, sizeof(declaration), "static const uint8_t %s_VARINT_DATA[]", base);
+        printValues(file, declaration, "", values, varintRules.dataLength);
+        fprintf(file, "\nstatic const ZoneOffsetType %s_OFFSET_TYPES[] = {\n", base);
+        for (uint32_t i = 0; i < varintRules.offsetTypeCount; i++) {
+            fprintf(file, "        {.gmtOffset = %d, .isDaylightTime = %s},\n", offsetTypes[i].gmtOffset, offsetTypes[i].isDaylightTime ? "true" : "false");
+        }
+        fprintf(file, "};\n\n");
+        fprintf(file, "const VarintTimeZoneRules %s = {.data = %s_VARINT_DATA, .offsetTypes = %s_OFFSET_TYPES,\n",
+                zone->rulesSymbol, base, base);
+        fprintf(file, "  .dataLength = %u, .ruleCount = %u, .offsetTypeCount = %u, .offsetIndexBits = %u};\n\n",
+                varintRules.dataLength, varintRules.ruleCount, varintRules.offsetTypeCount, varintRules.offsetIndexBits);
+    } else {
+        fprintf(stderr, "Can't pack rules of %s\n", zone->id);
+    }
+    free(data);
+    free(values);
+    return isPacked;
+}
+
+static void printZone(FILE *file, const GeneratedZone *zone, DataLayout layout, int64_t referenceEpoch) {
+    int32_t utcOffset = resolveTimeZoneOffset(referenceEpoch, zone->loadedZone);
+    fprintf(file, "        {.id = \"%s\", .utcOffset = %d, .names = %s", zone->id, utcOffset, zone->namesSymbol);
+    const GeneratedZone *tableZone = findTableZone(zone);
+    if (tableZone != NULL && layout == LAYOUT_TABLE) {
+        fprintf(file, ", .rules = %s, .ruleCount = ARRAY_SIZE(%s) - 1", tableZone->rulesSymbol, tableZone->rulesSymbol);
+    } else {
+        fprintf(file, ", .rules = NULL");
+    }
+    const GeneratedZone *recurringZone = findRecurringZone(zone);
+    if (recurringZone != NULL) {
+        fprintf(file, ", .recurringRule = &%s", recurringZone->recurringSymbol);
+    }
+    fprintf(file, "},\n");
+}
+
+static bool buildZoneIdHash(uint16_t *seeds, uint16_t *slots) {
+    static HashBucket buckets[ZONE_ID_HASH_BUCKET_COUNT];
+    static uint32_t zoneHashes[ZONE_ID_HASH_SLOT_COUNT];
+    for (uint16_t i = 0; i < ZONE_ID_HASH_BUCKET_COUNT; i++) {
+        buckets[i].bucketIndex = i;
+        buckets[i].zoneCount = 0;
+    }
+    for (uint16_t i = 0; i < ZONE_ID_HASH_SLOT_COUNT; i++) {
+        zoneHashes[i] = hashZoneId(zones[i].id, strlen(zones[i].id));
+        HashBucket *bucket = &buckets[zoneIdHashBucket(zoneHashes[i])];
+        if (bucket->zoneCount == ARRAY_SIZE(bucket->zoneIndexes)) {
+            fprintf(stderr, "Too many zones in bucket, increase ZONE_ID_HASH_BUCKET_COUNT\n");
+            return false;
+        }
+        bucket->zoneIndexes[bucket->zoneCount++] = i;
+        slots[i] = NO_ZONE_INDEX;
+    }
+
+    for (uint16_t i = 0; i < ZONE_ID_HASH_BUCKET_COUNT; i++) {   // place largest buckets first
+        HashBucket *largest = &buckets[i];
+        for (uint16_t j = i + 1; j < ZONE_ID_HASH_BUCKET_COUNT; j++) {
+            largest = buckets[j].zoneCount > largest->zoneCount ? &buckets[j] : largest;
+        }
+        HashBucket bucket = *largest;
+        *largest = buckets[i];
+        buckets[i] = bucket;
+
+        uint32_t placedSlots[16];
+        uint32_t seed = 0;
+        for (; seed < UINT16_MAX; seed++) {
+            bool isPlaced = true;
+            for (uint16_t j = 0; j < bucket.zoneCount && isPlaced; j++) {
+                placedSlots[j] = zoneIdHashSlot(zoneHashes[bucket.zoneIndexes[j]], seed);
+                isPlaced = slots[placedSlots[j]] == NO_ZONE_INDEX;
+                for (uint16_t k = 0; k < j && isPlaced; k++) {
+                    isPlaced = placedSlots[k] != placedSlots[j];
+                }
+            }
+            if (isPlaced) break;
+        }
+        if (seed == UINT16_MAX) {
+            fprintf(stderr, "No seed found for bucket %u, increase ZONE_ID_HASH_BUCKET_COUNT\n", bucket.bucketIndex);
+            return false;
+        }
+        for (uint16_t j = 0; j < bucket.zoneCount; j++) {
+            slots[placedSlots[j]] = bucket.zoneIndexes[j];
+        }
+        seeds[bucket.bucketIndex] = seed;
+    }
+    return true;
+}
+
+static void resolveNameOffsets(const GeneratedZone *zone, int64_t referenceEpoch, int32_t *standardOffset, int32_t *daylightOffset,
+                               bool *hasDaylightTime) {     // offsets of the last standard and daylight rules in the window
+    *standardOffset = resolveTimeZoneOffset(referenceEpoch, zone->loadedZone);
+    *hasDaylightTime = false;
+    for (uint32_t i = 0; i < zone->ruleCount; i++) {
+        if (zone->rules[i].isDaylightTime) {
+            *daylightOffset = zone->rules[i].gmtOffset;
+            *hasDaylightTime = true;
+        } else {
+            *standardOffset = zone->rules[i].gmtOffset;
+        }
+    }
+}
+
+static bool isPreferredNameZone(const char *zoneId) {
+    for (uint32_t i = 0; i < ARRAY_SIZE(PREFERRED_NAME_ZONES); i++) {
+        if (strcmp(PREFERRED_NAME_ZONES[i], zoneId) == 0) return true;
+    }
+    return false;
+}
+
+static void addNameCandidate(NameCandidate *candidates, uint32_t *candidateCount, const char *name, uint32_t zoneIndex,
+                             int32_t offset, bool isDaylightTime) {
+    if (name[0] == '\0' || name[0] == '+' || name[0] == '-') return;    // numeric abbreviation is parsed as offset
+    uint32_t aliasCount = countAliases(zoneIndex);
+    bool isPreferred = isPreferredNameZone(zones[zoneIndex].id);
+    for (uint32_t i = 0; i < *candidateCount; i++) {
+        NameCandidate *candidate = &candidates[i];
+        if (strcmp(candidate->candidate.name, name) == 0 && candidate->candidate.offset == offset &&
+            candidate->candidate.isDaylightTime == isDaylightTime) {
+            candidate->zoneCount += aliasCount + 1;
+            if (isPreferred || (!candidate->isPreferred && aliasCount > candidate->aliasCount)) {
+                candidate->candidate.zoneId = zones[zoneIndex].id;
+                candidate->aliasCount = aliasCount;
+                candidate->isPreferred = isPreferred;
+            }
+            return;
+        }
+    }
+    NameCandidate *candidate = &candidates[(*candidateCount)++];
+    candidate->candidate = (ZoneNameCandidate) {.name = name, .zoneId = zones[zoneIndex].id, .offset = offset, .isDaylightTime = isDaylightTime};
+    candidate->zoneCount = aliasCount + 1;
+    candidate->aliasCount = aliasCount;
+    candidate->isPreferred = isPreferred;
+}
+
+static int compareNameCandidates(const void *first, const void *second) {   // by name, preferred and most used first
+    const NameCandidate *candidate = first;
+    const NameCandidate *other = second;
+    int result = strcmp(candidate->candidate.name, other->candidate.name);
+    if (result != 0) return result;
+    if (candidate->isPreferred != other->isPreferred) return candidate->isPreferred ? -1 : 1;
+    if (candidate->zoneCount != other->zoneCount) return candidate->zoneCount > other->zoneCount ? -1 : 1;
+    return strcmp(candidate->candidate.zoneId, other->candidate.zoneId);
+}
+
+static bool buildZoneNameHash(NameCandidate *candidates, uint32_t *candidateCount, uint16_t *slots, int64_t referenceEpoch) {
+    *candidateCount = 0;
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        if (zones[i].linkIndex != i) continue;      // aliases share names of the canonical zone
+        int32_t standardOffset;
+        int32_t daylightOffset;
+        bool hasDaylightTime;
+        resolveNameOffsets(&zones[i], referenceEpoch, &standardOffset, &daylightOffset, &hasDaylightTime);
+        const char *const *names = zones[i].loadedZone->names;
+        addNameCandidate(candidates, candidateCount, names[ZONE_SHORT_NAME_STD_INDEX], i, standardOffset, false);
+        addNameCandidate(candidates, candidateCount, names[ZONE_LONG_NAME_STD_INDEX], i, standardOffset, false);
+        if (hasDaylightTime && strcmp(names[ZONE_SHORT_NAME_STD_INDEX], names[ZONE_SHORT_NAME_DTS_INDEX]) != 0) {   // such as "GMT" of London
+            addNameCandidate(candidates, candidateCount, names[ZONE_SHORT_NAME_DTS_INDEX], i, daylightOffset, true);
+            addNameCandidate(candidates, candidateCount, names[ZONE_LONG_NAME_DTS_INDEX], i, daylightOffset, true);
+        }
+    }
+    qsort(candidates, *candidateCount, sizeof(NameCandidate), compareNameCandidates);
+
+    for (uint32_t i = 0; i < ZONE_NAME_HASH_SLOT_COUNT; i++) {
+        slots[i] = ZONE_NAME_HASH_EMPTY_SLOT;
+    }
+    uint32_t nameCount = 0;
+    for (uint32_t i = 0; i < *candidateCount; i++) {
+        uint32_t sameNameCount = 1;
+        while (i + sameNameCount < *candidateCount && strcmp(candidates[i + sameNameCount].candidate.name, candidates[i].candidate.name) == 0) {
+            sameNameCount++;
+        }
+        for (uint32_t j = 0; j < sameNameCount; j++) {
+            candidates[i + j].candidate.candidateCount = (uint8_t) (sameNameCount - j);
+        }
+        if (++nameCount > ZONE_NAME_HASH_SLOT_COUNT / 2) {
+            fprintf(stderr, "Too many zone names, increase ZONE_NAME_HASH_SLOT_COUNT\n");
+            return false;
+        }
+        const char *name = candidates[i].candidate.name;
+        uint32_t slot = zoneNameHashSlot(hashZoneId(name, strlen(name)));
+        while (slots[slot] != ZONE_NAME_HASH_EMPTY_SLOT) {
+            slot = zoneNameHashSlot(slot + 1);
+        }
+        slots[slot] = (uint16_t) i;
+        i += sameNameCount - 1;
+    }
+    return true;
+}
+
+static void printNameCandidates(FILE *file, const NameCandidate *candidates, uint32_t candidateCount) {
+    fprintf(file, "const ZoneNameCandidate ZONE_NAME_CANDIDATES[] = {\n");
+    for (uint32_t i = 0; i < candidateCount; i++) {
+        const ZoneNameCandidate *candidate = &candidates[i].candidate;
+        fprintf(file, "        {.name = \"%s\", .zoneId = \"%s\", .offset = %d, .isDaylightTime = %s, .candidateCount = %u},\n",
+                candidate->name, candidate->zoneId, candidate->offset, candidate->isDaylightTime ? "true" : "false", candidate->candidateCount);
+    }
+    fprintf(file, "};\n");
+}
+
+static bool writeTimeZoneData(const char *path, DataLayout layout, bool hasIdHash, int64_t referenceEpoch) {
+    static uint16_t seeds[ZONE_ID_HASH_BUCKET_COUNT];
+    static uint16_t slots[ZONE_ID_HASH_SLOT_COUNT];
+    static uint32_t values[ZONE_NAME_HASH_SLOT_COUNT > MAX_ZONE_COUNT ? ZONE_NAME_HASH_SLOT_COUNT : MAX_ZONE_COUNT];
+    static NameCandidate nameCandidates[MAX_NAME_CANDIDATE_COUNT];
+    static uint16_t nameSlots[ZONE_NAME_HASH_SLOT_COUNT];
+    uint32_t nameCandidateCount;
+    if (!buildZoneNameHash(nameCandidates, &nameCandidateCount, nameSlots, referenceEpoch)) return false;
+    if (hasIdHash && zoneCount != ZONE_ID_HASH_SLOT_COUNT) {
+        fprintf(stderr, "ZONE_ID_HASH_SLOT_COUNT should be %u, update TimeZoneIdHash.h and rebuild or use -n\n", zoneCount);
+        return false;
+    }
+    if (hasIdHash && !buildZoneIdHash(seeds, slots)) return false;
+
+    FILE *file = fopen(path, "w");
+    if (file == NULL) return false;
+    fprintf(file, "#include \"TimeZone.h\"\n#include \"TimeZoneIdHash.h\"\n#include \"TimeZoneNameHash.h\"\n\n");
+    fprintf(file, "/* Time zone names, rules and zone list data.\n");
+    fprintf(file, " * Defined once in this compilation unit, headers contain only extern declarations.\n");
+    fprintf(file, " * Generated by tools/TimeZoneDataGenerator.c from tzdata %s:\n", tzdataVersion);
+    fprintf(file, " *  %s*/\n\n", commandLine);
+
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        if (isUniversalNames(zones[i].namesSymbol) && isFirstNamesUse(i)) printNames(file, &zones[i]);
+    }
+    fprintf(file, "#ifdef ENABLE_TIME_ZONE_SUPPORT\n");
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        if (!isUniversalNames(zones[i].namesSymbol) && isFirstNamesUse(i)) printNames(file, &zones[i]);
+    }
+    fprintf(file, "#endif\n\n#ifdef ENABLE_TIME_ZONE_SUPPORT\n\n");
+
+    bool isWritten = true;
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        if (zones[i].rulesZoneIndex != i) continue;
+        if (layout == LAYOUT_TABLE) {
+            printRuleTable(file, &zones[i]);
+        } else if (layout == LAYOUT_COMPACT) {
+            isWritten &= printCompactRuleTable(file, &zones[i]);
+        } else {
+            isWritten &= printVarintRuleTable(file, &zones[i]);
+        }
+    }
+    uint16_t recurringZoneIndexes[MAX_ZONE_COUNT];
+    uint32_t recurringCount = sortRecurringZones(recurringZoneIndexes);
+    for (uint32_t i = 0; i < recurringCount; i++) {
+        printRecurringRule(file, &zones[recurringZoneIndexes[i]]);
+    }
+    fprintf(file, "#endif\n\n");
+
+    fprintf(file, "const TimeZone UTC = {.id = \"UTC\", .utcOffset = 0, .names = UTC_ZONE_NAMES, .rules = NULL};\n");
+    fprintf(file, "const TimeZone GMT = {.id = \"GMT\", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL};\n\n");
+    fprintf(file, "const TimeZone ZONE_LIST[] = {\n        #ifdef ENABLE_TIME_ZONE_SUPPORT\n");
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        printZone(file, &zones[i], layout, referenceEpoch);
+    }
+    fprintf(file, "        #endif\n};\n\nconst uint16_t ZONE_LIST_LENGTH = ARRAY_SIZE(ZONE_LIST);\n");
+    fprintf(file, "const char *const TIME_ZONE_DATA_VERSION = \"%s\";\n\n#ifdef ENABLE_TIME_ZONE_SUPPORT\n\n", tzdataVersion);
+
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        values[i] = zones[i].linkIndex;
+    }
+    printValues(file, "const uint16_t ZONE_LINK_INDEXES[]", "    // canonical zone index for each ZONE_LIST entry, alias points to its link target",
+                values, zoneCount);
+    if (layout != LAYOUT_TABLE) {
+        fprintf(file, (layout == LAYOUT_COMPACT) ? "\nconst CompactTimeZoneRules *const ZONE_COMPACT_RULES[] = {\n" :
+                      "\nconst VarintTimeZoneRules *const ZONE_VARINT_RULES[] = {\n");
+        for (uint32_t i = 0; i < zoneCount; i++) {
+            const GeneratedZone *tableZone = findTableZone(&zones[i]);
+            fprintf(file, tableZone != NULL ? "        &%s,\n" : "        NULL,\n", tableZone != NULL ? tableZone->rulesSymbol : "");
+        }
+        fprintf(file, "};\n");
+    }
+    fprintf(file, "\n#endif\n");
+
+    if (hasIdHash) {
+        fprintf(file, "\n#if defined(ENABLE_TIME_ZONE_SUPPORT) && !defined(ENABLE_TIME_ZONE_SUBSET)\n\n");
+        fprintf(file, "/* Generated by tools/TimeZoneDataGenerator.c, regenerate when ZONE_LIST changes*/\n");
+        for (uint32_t i = 0; i < ZONE_ID_HASH_BUCKET_COUNT; i++) {
+            values[i] = seeds[i];
+        }
+        printValues(file, "const uint16_t ZONE_ID_HASH_SEEDS[ZONE_ID_HASH_BUCKET_COUNT]", "", values, ZONE_ID_HASH_BUCKET_COUNT);
+        for (uint32_t i = 0; i < ZONE_ID_HASH_SLOT_COUNT; i++) {
+            values[i] = slots[i];
+        }
+        fprintf(file, "\n");
+        printValues(file, "const uint16_t ZONE_ID_HASH_SLOTS[ZONE_ID_HASH_SLOT_COUNT]", "", values, ZONE_ID_HASH_SLOT_COUNT);
+        fprintf(file, "\n#endif\n");
+    }
+
+    fprintf(file, "\n#ifdef ENABLE_TIME_ZONE_SUPPORT\n\n");
+    fprintf(file, "/* Generated by tools/TimeZoneDataGenerator.c, regenerate when zone names change*/\n");
+    printNameCandidates(file, nameCandidates, nameCandidateCount);
+    for (uint32_t i = 0; i < ZONE_NAME_HASH_SLOT_COUNT; i++) {
+        values[i] = nameSlots[i];
+    }
+    fprintf(file, "\n");
+    printValues(file, "const uint16_t ZONE_NAME_HASH_SLOTS[ZONE_NAME_HASH_SLOT_COUNT]", "", values, ZONE_NAME_HASH_SLOT_COUNT);
+    fprintf(file, "\n#endif\n");
+    fclose(file);
+    return isWritten;
+}
+
+static char *readFile(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *content = malloc(size + 1);
+    if (content != NULL) {
+        content[fread(content, 1, size, file)] = '\0';
+    }
+    fclose(file);
+    return content;
+}
+
+/* Replaces lines between the first "#ifdef ENABLE_TIME_ZONE_SUPPORT" and following "#endif" with block from temporary file*/
+static bool replaceDeclarationBlock(const char *path, const char *blockPath) {
+    char *content = readFile(path);
+    char *block = readFile(blockPath);
+    remove(blockPath);
+    char *start = content != NULL ? strstr(content, "#ifdef ENABLE_TIME_ZONE_SUPPORT\n") : NULL;
+    char *end = start != NULL ? strstr(start, "#endif") : NULL;
+    bool isReplaced = block != NULL && end != NULL;
+    if (isReplaced) {
+        FILE *file = fopen(path, "w");
+        isReplaced = file != NULL;
+        if (isReplaced) {
+            start += strlen("#ifdef ENABLE_TIME_ZONE_SUPPORT\n");
+            fwrite(content, 1, start - content, file);
+            fputs(block, file);
+            fputs(end, file);
+            fclose(file);
+        }
+    } else {
+        fprintf(stderr, "No declaration block in %s\n", path);
+    }
+    free(content);
+    free(block);
+    return isReplaced;
+}
+
+static bool writeNameDeclarations(const char *path) {
+    char blockPath[ZONE_INFO_PATH_MAX_LENGTH + 8];
+    snprintf(blockPath, sizeof(blockPath), "%s.block", path);
+    FILE *file = fopen(blockPath, "w");
+    if (file == NULL) return false;
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        if (!isUniversalNames(zones[i].namesSymbol) && isFirstNamesUse(i)) {
+            fprintf(file, "extern const char *const %s[];\n", zones[i].namesSymbol);
+        }
+    }
+    fclose(file);
+    return replaceDeclarationBlock(path, blockPath);
+}
+
+static bool writeRuleDeclarations(const char *path, DataLayout layout) {
+    char blockPath[ZONE_INFO_PATH_MAX_LENGTH + 8];
+    snprintf(blockPath, sizeof(blockPath), "%s.block", path);
+    FILE *file = fopen(blockPath, "w");
+    if (file == NULL) return false;
+    const char *type = (layout == LAYOUT_TABLE) ? "TimeZoneRule" : (layout == LAYOUT_COMPACT) ? "CompactTimeZoneRules" : "VarintTimeZoneRules";
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        const GeneratedZone *zone = &zones[i];
+        if (zone->rulesZoneIndex == i) {
+            fprintf(file, "extern const %s %s%s;\n", type, zone->rulesSymbol, (layout == LAYOUT_TABLE) ? "[]" : "");
+        } else if (zone->rulesZoneIndex != NO_ZONE_INDEX) {
+            fprintf(file, "#define %s %s    // same transitions\n", zone->rulesSymbol, zones[zone->rulesZoneIndex].rulesSymbol);
+        }
+    }
+    uint16_t recurringZoneIndexes[MAX_ZONE_COUNT];
+    uint32_t recurringCount = sortRecurringZones(recurringZoneIndexes);
+    for (uint32_t i = 0; i < recurringCount; i++) {
+        fprintf(file, "extern const ZoneRecurringRule %s;\n", zones[recurringZoneIndexes[i]].recurringSymbol);
+    }
+    fclose(file);
+    return replaceDeclarationBlock(path, blockPath);
+}
+
+static int64_t yearStartEpochSecond(int64_t year) {
+    Date date = dateOf(year, 1, 1);
+    return dateToEpochDay(&date) * SECONDS_PER_DAY;
+}
+
+int main(int argc, char *argv[]) {
+    const char *rootDirectory = ".";
+    int64_t fromYear = DEFAULT_FROM_YEAR;
+    int64_t toYear = DEFAULT_TO_YEAR;
+    int64_t referenceYear = DEFAULT_REFERENCE_YEAR;
+    DataLayout layout = LAYOUT_TABLE;
+    bool isAllZones = false;
+    bool hasIdHash = true;
+
+    int option;
+    while ((option = getopt(argc, argv, "d:o:f:t:l:r:an")) != -1) {
+        switch (option) {
+            case 'd': zoneInfoDirectory = optarg; break;
+            case 'o': rootDirectory = optarg; break;
+            case 'f': fromYear = strtoll(optarg, NULL, 10); break;
+            case 't': toYear = strtoll(optarg, NULL, 10); break;
+            case 'r': referenceYear = strtoll(optarg, NULL, 10); break;
+            case 'l':
+                layout = (strcmp(optarg, "compact") == 0) ? LAYOUT_COMPACT : (strcmp(optarg, "varint") == 0) ? LAYOUT_VARINT : LAYOUT_TABLE;
+                break;
+            case 'a': isAllZones = true; break;
+            case 'n': hasIdHash = false; break;
+            default:
+                fprintf(stderr, "Usage: %s [-d zoneInfoDir] [-o rootDir] [-f fromYear] [-t toYear] [-l table|compact|varint] [-r referenceYear] [-a] [-n]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (!setZoneInfoDirectory(zoneInfoDirectory)) return EXIT_FAILURE;
+    readTzdataVersion();
+    buildCommandLine(argc, argv);
+
+    if (isAllZones) {
+        nftw(zoneInfoDirectory, addZoneFile, 16, FTW_PHYS);
+    } else {
+        for (uint16_t i = 0; i < getTimeZoneCount(); i++) {
+            addZoneId(getTimeZoneByIndex(i)->id);
+        }
+    }
+    qsort(zones, zoneCount, sizeof(GeneratedZone), compareZoneIds);
+
+    int64_t fromEpoch = yearStartEpochSecond(fromYear);
+    int64_t toEpoch = yearStartEpochSecond(toYear + 1);
+    uint32_t loadedCount = 0;
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        if (loadZoneRules(&zones[i], fromEpoch, toEpoch)) {
+            zones[loadedCount++] = zones[i];
+        } else if (!isAllZones) {
+            fprintf(stderr, "Skipped zone: %s\n", zones[i].id);
+        }
+    }
+    zoneCount = loadedCount;
+
+    for (uint32_t i = 0; i < zoneCount; i++) {   // aliases from current zone links, other zones are canonical
+        zones[i].linkIndex = i;
+        const TimeZone *compiledZone = findTimeZone(zones[i].id);
+        const TimeZone *canonicalZone = compiledZone != NULL ? getCanonicalTimeZone(compiledZone) : NULL;
+        for (uint32_t j = 0; canonicalZone != NULL && canonicalZone != compiledZone && j < zoneCount; j++) {
+            if (strcmp(zones[j].id, canonicalZone->id) == 0) zones[i].linkIndex = j;
+        }
+        resolveNamesSymbol(i);
+    }
+    for (uint32_t i = 0; i < zoneCount; i++) {
+        resolveRecurringSymbol(i);
+    }
+    resolveRuleTables((layout == LAYOUT_TABLE) ? "_RULES" : (layout == LAYOUT_COMPACT) ? "_COMPACT_RULES" : "_VARINT_RULES");
+
+    char path[ZONE_INFO_PATH_MAX_LENGTH];
+    snprintf(path, sizeof(path), "%s/TimeZoneData.c", rootDirectory);
+    Date referenceDate = dateOf(referenceYear, JULY, 1);
+    int64_t referenceEpoch = dateToEpochDay(&referenceDate) * SECONDS_PER_DAY;
+    if (!writeTimeZoneData(path, layout, hasIdHash, referenceEpoch)) return EXIT_FAILURE;
+    snprintf(path, sizeof(path), "%s/include/TimeZoneNames.h", rootDirectory);
+    if (!writeNameDeclarations(path)) return EXIT_FAILURE;
+    snprintf(path, sizeof(path), "%s/include/TimeZoneRules.h", rootDirectory);
+    if (!writeRuleDeclarations(path, layout)) return EXIT_FAILURE;
+
+    fprintf(stderr, "Generated %u zones\n", zoneCount);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+#include <getopt.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "GlobalDateTime.h"
+
+/* Compares zone rule search implementations on the same random epoch seconds inside zone rules range:
+ *  linear  - scan of zone rules until the first transition not before epoch seconds
+ *  binary  - findZoneRuleTransition()
+ *  indexed - findIndexedZoneRuleTransition() with each block compare kernel supported by CPU
+ * Build with tools/CMakeLists.txt: cmake -S tools -B build && cmake --build build
+ * Usage: ./build/ZoneRuleSearchBenchmark [-z zoneId] [-n lookupCount]*/
+
+#define DEFAULT_ZONE_ID "America/New_York"
+#define DEFAULT_LOOKUP_COUNT 10000000
+#define EPOCH_SAMPLE_COUNT 4096     // power of two, cycled by lookups
+
+typedef ZoneTransition (*ZoneRuleSearch)(int64_t epochSeconds, const TimeZone *zone, const ZoneTransitionIndex *index);
+
+static const char *const KERNEL_NAMES[] = {"scalar", "sse4.2", "avx2"};
+
+static ZoneTransition searchLinear(int64_t epochSeconds, const TimeZone *zone, const ZoneTransitionIndex *index) {
+    (void) index;
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    uint32_t ruleIndex = 0;
+    while (ruleIndex < zone->ruleCount && zone->rules[ruleIndex].transition < epochSeconds) {
+        ruleIndex++;
+    }
+    if (zone->ruleCount > 1 && ruleIndex < zone->ruleCount) {
+        ruleIndex = (ruleIndex > 0) ? ruleIndex : 1;
+        zoneTransition.before = &zone->rules[ruleIndex - 1];
+        zoneTransition.after = &zone->rules[ruleIndex];
+    }
+    return zoneTransition;
+}
+
+static ZoneTransition searchBinary(int64_t epochSeconds, const TimeZone *zone, const ZoneTransitionIndex *index) {
+    (void) index;
+    return findZoneRuleTransition(epochSeconds, zone);
+}
+
+static ZoneTransition searchIndexed(int64_t epochSeconds, const TimeZone *zone, const ZoneTransitionIndex *index) {
+    (void) zone;
+    return findIndexedZoneRuleTransition(epochSeconds, index);
+}
+
+static void runBenchmark(const char *name, ZoneRuleSearch search, const int64_t *epochs, uint32_t lookupCount,
+                         const TimeZone *zone, const ZoneTransitionIndex *index) {
+    int64_t checksum = 0;
+    clock_t start = clock();
+    for (uint32_t i = 0; i < lookupCount; i++) {
+        ZoneTransition zoneTransition = search(epochs[i & (EPOCH_SAMPLE_COUNT - 1)], zone, index);
+        checksum += (zoneTransition.after != NULL) ? zoneTransition.after->transition : 0;
+    }
+    double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("%-16s %8.2f ns/lookup  (checksum %lld)\n", name, seconds * 1e9 / lookupCount, (long long) checksum);
+}
+
+int main(int argc, char *argv[]) {
+    const char *zoneId = DEFAULT_ZONE_ID;
+    uint32_t lookupCount = DEFAULT_LOOKUP_COUNT;
+
+    int option;
+    while ((option = getopt(argc, argv, "z:n:")) != -1) {
+        switch (option) {
+            case 'z': zoneId = optarg; break;
+            case 'n': lookupCount = (uint32_t) strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "Usage: %s [-z zoneId] [-n lookupCount]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    const TimeZone *zone = findTimeZone(zoneId);
+    if (zone == NULL || zone->ruleCount <= 1) {
+        fprintf(stderr, "Zone '%s' not found or has no rules\n", zoneId);
+        return EXIT_FAILURE;
+    }
+
+    ZoneTransitionBlock *blocks = malloc(ZONE_TRANSITION_BLOCK_COUNT(zone->ruleCount) * sizeof(ZoneTransitionBlock));
+    ZoneTransitionIndex index;
+    if (blocks == NULL || !buildZoneTransitionIndex(zone, blocks, ZONE_TRANSITION_BLOCK_COUNT(zone->ruleCount), &index)) {
+        fprintf(stderr, "Unable to build transition index\n");
+        free(blocks);
+        return EXIT_FAILURE;
+    }
+
+    int64_t epochs[EPOCH_SAMPLE_COUNT];
+    int64_t firstTransition = zone->rules[0].transition;
+    int64_t range = zone->rules[zone->ruleCount - 1].transition - firstTransition;
+    srand(1);
+    for (uint32_t i = 0; i < EPOCH_SAMPLE_COUNT; i++) {
+        int64_t random = ((int64_t) rand() << 31) ^ rand();
+        epochs[i] = firstTransition + (random % range);
+    }
+
+    printf("Zone %s, %u rules, %u lookups\n", zone->id, zone->ruleCount, lookupCount);
+    runBenchmark("linear", searchLinear, epochs, lookupCount, zone, &index);
+    runBenchmark("binary", searchBinary, epochs, lookupCount, zone, &index);
+    ZoneSearchKernel detectedKernel = index.kernel;
+    for (int kernel = ZONE_SEARCH_SCALAR; kernel <= (int) detectedKernel; kernel++) {
+        char name[32];
+        snprintf(name, sizeof(name), "indexed %s", KERNEL_NAMES[kernel]);
+        index.kernel = (ZoneSearchKernel) kernel;
+        runBenchmark(name, searchIndexed, epochs, lookupCount, zone, &index);
+    }
+    free(blocks);
+    return EXIT_SUCCESS;
+}